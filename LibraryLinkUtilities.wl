@@ -128,6 +128,36 @@ preferably, by calling MArgumentType.";
 MResultTransform::usage = "MResultTransform[t] must evaluate to a one-argument function that takes a LibraryLink-compatible expression
 and returns an expression of \"type\" t. DownValues for this symbol can be provided by developers either directly or, preferably, by calling MResultType.";
 
+(* ---------------- Packed strings ----------------------------------------- *)
+
+ToPackedStrings::usage = "ToPackedStrings[strings_List]
+	returns a pair of NumericArrays {bytes, offsets} with UTF-8 bytes of all strings and positions where they start, which can be read as LLU::PackedStrings.
+	Library functions loaded with \"PackedStrings\" argument type do this conversion automatically.";
+
+PackedStringsToList::usage = "PackedStringsToList[packed_Developer`DataStore]
+	converts strings packed with LLU::PackedStrings into a list of Strings.
+	Library functions loaded with \"PackedStrings\" return type do this conversion automatically.";
+
+(* ---------------- Columnar tables ---------------------------------------- *)
+
+DataTableColumns::usage = "DataTableColumns[table_Developer`DataStore]
+	converts a columnar table built with LLU::DataTableBuilder into an Association of column names and lists of column values.";
+
+DataTableRows::usage = "DataTableRows[table_Developer`DataStore]
+	converts a columnar table built with LLU::DataTableBuilder into a list of Associations, one per row.
+	Library functions loaded with \"DataTable\" return type do this conversion automatically.";
+
+(* ---------------- DataList profiling ------------------------------------- *)
+
+DataListProfile::usage = "DataListProfile[ds_Developer`DataStore]
+	returns an Association with node counts per type, payload bytes of arrays and strings and maximal depth of a nested DataStore, as computed by LLU::profileDataList.";
+
+(* ---------------- DataList streaming ------------------------------------- *)
+
+CollectDataListStream::usage = "CollectDataListStream[f_LibraryFunction, args_List, opts]
+	calls LibraryFunction f (loaded with LibraryFunctionLoad) on args to start an asynchronous task created with LLU::startDataListStream,
+	waits for all chunks of nodes that the task sends and joins them into one Developer`DataStore. Option \"ChunkHandler\" specifies a function that is called on every chunk as soon as it arrives.";
+
 (* ---------------- Logging ------------------------------------------------ *)
 
 `Logger`LogToList::usage = "LogToList[args___]
@@ -216,6 +246,7 @@ $InitializePacletLibrary[libPath_?StringQ] := (
 	(* Load library functions for initializing different parts of LLU. *)
 	PacletFunctionSet[$SetLoggerContext, "setLoggerContext", {String}, String, "Optional" -> True];
 	PacletFunctionSet[$SetExceptionDetailsContext, "setExceptionDetailsContext", {String}, String];
+	PacletFunctionSet[$GetDataListProfile, "getDataListProfile", {"DataStore"}, "DataStore", "Optional" -> True];
 	(* Tell C++ part of LLU in which context were top-level symbols loaded. *)
 	SetContexts[$LLULoadingContext, $LLULoadingContext <> "Private`"];
 	$PacletLibrary
@@ -352,6 +383,78 @@ SelectSpecialArgs[LinkObject] = {};
  *)
 ArgumentParser[specialArgs_?AssociationQ] := Sequence @@ MapIndexed[MArgumentTransform[specialArgs[First @ #2]][#1] &, {##}]&;
 
+(* ::SubSection:: *)
+(* Packed strings *)
+(* ------------------------------------------------------------------------- *)
+
+ToPackedStrings[strings : {___String}] :=
+	With[{codes = ToCharacterCode[strings, "UTF-8"]},
+		{NumericArray[Join @@ codes, "UnsignedInteger8"], NumericArray[Prepend[Accumulate[Length /@ codes], 0], "Integer64"]}
+	];
+
+PackedStringsToList[Developer`DataStore["Values" -> bytes_NumericArray, "Offsets" -> offsets_NumericArray]] :=
+	FromCharacterCode[#, "UTF-8"]& /@ TakeList[Normal[bytes], Differences[Normal[offsets]]];
+
+(* Lists of strings are passed to library functions as two NumericArrays and returned as a DataStore with the same two NumericArrays *)
+MArgumentType["PackedStrings", {NumericArray, NumericArray}, Sequence @@ ToPackedStrings[#]&];
+MResultType["PackedStrings", "DataStore", PackedStringsToList];
+
+(* ::SubSection:: *)
+(* Columnar tables *)
+(* ------------------------------------------------------------------------- *)
+
+(* A column is either a flat NumericArray or a DataStore with packed strings *)
+DataTableColumn[values_NumericArray] := Normal[values];
+DataTableColumn[strings_Developer`DataStore] := PackedStringsToList[strings];
+
+DataTableColumns[table_Developer`DataStore] := Association[Replace[List @@ table, (name_ -> column_) :> (name -> DataTableColumn[column]), {1}]];
+
+DataTableRows[table_Developer`DataStore] :=
+	With[{columns = DataTableColumns[table]},
+		If[Length[columns] == 0,
+			{}
+			,
+			AssociationThread[Keys[columns], #]& /@ Transpose[Values[columns]]
+		]
+	];
+
+(* Tables are returned from library functions as DataStores and converted to lists of rows *)
+MResultType["DataTable", "DataStore", DataTableRows];
+
+(* ::SubSection:: *)
+(* DataList profiling *)
+(* ------------------------------------------------------------------------- *)
+
+DataStoreToAssociation[ds_Developer`DataStore] := Association[Replace[List @@ ds, (name_ -> nested_Developer`DataStore) :> (name -> DataStoreToAssociation[nested]), {1}]];
+
+DataListProfile[ds_Developer`DataStore] := DataStoreToAssociation[$GetDataListProfile[ds]];
+
+(* ::SubSection:: *)
+(* DataList streaming *)
+(* ------------------------------------------------------------------------- *)
+
+Options[CollectDataListStream] = {
+	"ChunkHandler" -> None
+};
+
+(* Chunks of nodes arrive as events of an asynchronous task, event data is converted to a DataStore because older versions deliver it as a List *)
+CollectDataListStream[f_LibraryFunction, args_List, opts : OptionsPattern[]] :=
+	Module[{chunks = Internal`Bag[], handler = OptionValue["ChunkHandler"], result = None, task},
+		task = Internal`CreateAsynchronousTask[f, args,
+			Replace[{#2, Developer`DataStore @@ #3}, {
+				{"DataListChunk", chunk_} :> (
+					Internal`StuffBag[chunks, chunk];
+					If[handler =!= None, handler[chunk]]
+				),
+				{"DataListFinished", _} :> (result = Join[Developer`DataStore[], Sequence @@ Internal`BagPart[chunks, All]]),
+				{"DataListFailure", Developer`DataStore["Error" -> name_String]} :> (result = CreatePacletFailure[name])
+			}]&
+		];
+		WaitAsynchronousTask[task];
+		(* the task may also end without the final event if it was removed before the producer finished *)
+		Replace[result, None :> CreatePacletFailure["FunctionError"]]
+	];
+
 (* ::SubSection:: *)
 (* Loading dynamic libraries and library functions *)
 (* ------------------------------------------------------------------------- *)
@@ -6,6 +6,9 @@
 #ifndef LLU_ASYNC_UTILITIES_H
 #define LLU_ASYNC_UTILITIES_H
 
+#include <algorithm>
+#include <cstddef>
+#include <exception>
 #include <functional>
 #include <future>
 #include <memory>
@@ -129,6 +132,67 @@ namespace LLU::Async {
 		return std::packaged_task<result_type()> {std::move(boundF)};
 	}
 
+	/**
+	 * Run tasks with indices 0, 1, ..., \p taskCount - 1, the first one in the calling thread and the others on a thread pool, and wait for all of them.
+	 * If any task throws, the remaining tasks are still waited for, because they usually refer to data owned by the caller, and then the first
+	 * exception is rethrown. Right after a task throws, \p onError is called in the same thread, so that the other tasks can stop early,
+	 * e.g. by moving a shared counter of work items past the end.
+	 * @tparam Pool - thread pool type with a submit member function, e.g. LLU::ThreadPool or LLU::BasicPool
+	 * @param pool - thread pool
+	 * @param taskCount - number of tasks, values smaller than 1 are treated as 1
+	 * @param task - callable taking the index of a task (std::size_t), it is called concurrently from different threads
+	 * @param onError - callable taking no arguments, it may be called concurrently by several tasks that throw
+	 * @note The calling thread blocks until all tasks finish, so this function must not be called from a task running on the same pool.
+	 */
+	template<typename Pool, typename F, typename OnError>
+	void runTasks(Pool& pool, std::size_t taskCount, F&& task, OnError&& onError) {
+		auto guarded = [&task, &onError](std::size_t index) {
+			try {
+				task(index);
+			} catch (...) {
+				onError();
+				throw;
+			}
+		};
+		taskCount = std::max<std::size_t>(taskCount, 1);
+		std::vector<std::future<void>> pending;
+		pending.reserve(taskCount - 1);
+		std::exception_ptr error;
+		try {
+			for (std::size_t index = 1; index < taskCount; ++index) {
+				pending.push_back(pool.submit(guarded, index));
+			}
+			guarded(0);
+		} catch (...) {
+			error = std::current_exception();
+		}
+		for (auto& fut : pending) {
+			try {
+				fut.get();
+			} catch (...) {
+				if (!error) {
+					error = std::current_exception();
+				}
+			}
+		}
+		if (error) {
+			std::rethrow_exception(error);
+		}
+	}
+
+	/**
+	 * Run tasks with indices 0, 1, ..., \p taskCount - 1, the first one in the calling thread and the others on a thread pool, and wait for all of them.
+	 * The first exception thrown by any task is rethrown after all tasks finish.
+	 * @tparam Pool - thread pool type with a submit member function, e.g. LLU::ThreadPool or LLU::BasicPool
+	 * @param pool - thread pool
+	 * @param taskCount - number of tasks, values smaller than 1 are treated as 1
+	 * @param task - callable taking the index of a task (std::size_t), it is called concurrently from different threads
+	 */
+	template<typename Pool, typename F>
+	void runTasks(Pool& pool, std::size_t taskCount, F&& task) {
+		runTasks(pool, taskCount, std::forward<F>(task), [] {});
+	}
+
 	/**
 	 * @class Pausable
 	 * @brief Utility class for pausable task queues.
@@ -0,0 +1,270 @@
+/**
+ * @file	AlignedBuffer.hpp
+ * @brief	Aligned workspace memory for vectorized kernels operating on container data.
+ *
+ * Buffers of LibraryLink containers are allocated by the Kernel and there is no guarantee about their alignment beyond the alignment of the element
+ * type. AlignedBuffer owns memory aligned to a cache line, which is a suitable workspace for SIMD kernels, and alignedLoop splits processing
+ * of arbitrary (possibly unaligned) data into a scalar head, a body of full aligned blocks and a scalar tail.
+ */
+#ifndef LLU_CONTAINERS_ALIGNEDBUFFER_HPP
+#define LLU_CONTAINERS_ALIGNEDBUFFER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "LLU/Containers/Iterators/IterableContainer.hpp"
+#include "LLU/Containers/MArrayDimensions.h"
+#include "LLU/Containers/NumericArray.h"
+#include "LLU/ErrorLog/ErrorManager.h"
+#include "LLU/Utilities.hpp"
+
+namespace LLU {
+
+	/// Alignment (in bytes) of memory owned by AlignedBuffer, equal to the size of a cache line and of the widest common SIMD registers
+	inline constexpr std::size_t CacheLineSize = 64;
+
+	/// Whether AlignedBuffer should request transparent huge pages for large buffers
+	enum class HugePages : bool { No, Yes };
+
+	/**
+	 * @brief   Contiguous, fixed-size array of trivial elements, aligned to CacheLineSize bytes
+	 *
+	 * Large buffers (of at least AlignedBuffer::HugePageThreshold bytes) can be aligned to the huge page size and marked with
+	 * madvise(MADV_HUGEPAGE), which asks the Linux kernel to back them with transparent huge pages and reduces TLB misses when they are traversed.
+	 * On other systems the hint is ignored.
+	 *
+	 * @tparam  T - type of elements, must be trivially copyable
+	 */
+	template<typename T>
+	class AlignedBuffer : public IterableContainer<T> {
+		static_assert(std::is_trivially_copyable_v<T>, "AlignedBuffer can only store trivially copyable types.");
+		static_assert(alignof(T) <= CacheLineSize, "Type alignment exceeds the alignment of AlignedBuffer.");
+
+	public:
+		/// Size of a transparent huge page on x86-64 and most ARM64 Linux systems
+		static constexpr std::size_t HugePageSize = std::size_t {2} << 20U;
+
+		/// Minimal size (in bytes) of a buffer for which huge pages are requested
+		static constexpr std::size_t HugePageThreshold = 2 * HugePageSize;
+
+		/// Number of elements of type T in a cache line
+		static constexpr mint Lanes = static_cast<mint>(std::max(CacheLineSize / sizeof(T), std::size_t {1}));
+
+		AlignedBuffer() = default;
+
+		/**
+		 * @brief   Allocate an uninitialized buffer
+		 * @param   size - number of elements
+		 * @param   hugePages - whether to request transparent huge pages for large buffers
+		 */
+		explicit AlignedBuffer(mint size, HugePages hugePages = HugePages::Yes) : length {size} {
+			if (size < 0) {
+				ErrorManager::throwException(ErrorName::DimensionsError);
+			}
+			allocate(hugePages == HugePages::Yes);
+		}
+
+		/**
+		 * @brief   Allocate a buffer with all elements equal to \p init
+		 * @param   size - number of elements
+		 * @param   init - initial value of all elements
+		 * @param   hugePages - whether to request transparent huge pages for large buffers
+		 */
+		AlignedBuffer(mint size, T init, HugePages hugePages = HugePages::Yes) : AlignedBuffer(size, hugePages) {
+			std::fill(this->begin(), this->end(), init);
+		}
+
+		/**
+		 * @brief   Create a buffer with contents copied from a given collection of data, e.g. a NumericArray
+		 * @tparam  Container - any iterable collection of data with a \c value_type alias member equal to T and a size() member function
+		 * @param   c - const reference to a collection from which data will be copied to the buffer
+		 * @param   hugePages - whether to request transparent huge pages for large buffers
+		 */
+		template<class Container, typename = std::enable_if_t<is_iterable_container_with_matching_type_v<Container, T> && has_size_v<Container>>>
+		explicit AlignedBuffer(const Container& c, HugePages hugePages = HugePages::Yes) : AlignedBuffer(static_cast<mint>(c.size()), hugePages) {
+			std::copy(std::begin(c), std::end(c), this->begin());
+		}
+
+		/**
+		 * @brief   Copy constructor, the new buffer has the same alignment and huge page setting
+		 * @param   other - buffer to copy
+		 */
+		AlignedBuffer(const AlignedBuffer& other) : length {other.length} {
+			allocate(other.hugePageHint);
+			std::copy(other.begin(), other.end(), this->begin());
+		}
+
+		/**
+		 * @brief   Copy-assignment operator
+		 * @param   other - buffer to copy
+		 * @return  reference to this buffer
+		 */
+		AlignedBuffer& operator=(const AlignedBuffer& other) {
+			if (this != &other) {
+				*this = AlignedBuffer {other};
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief   Move constructor, \p other is left empty
+		 * @param   other - buffer to move from
+		 */
+		AlignedBuffer(AlignedBuffer&& other) noexcept
+			: buffer {std::move(other.buffer)}, length {std::exchange(other.length, 0)}, hugePageHint {std::exchange(other.hugePageHint, false)} {}
+
+		/**
+		 * @brief   Move-assignment operator, \p other is left empty
+		 * @param   other - buffer to move from
+		 * @return  reference to this buffer
+		 */
+		AlignedBuffer& operator=(AlignedBuffer&& other) noexcept {
+			if (this != &other) {
+				buffer = std::move(other.buffer);
+				length = std::exchange(other.length, 0);
+				hugePageHint = std::exchange(other.hugePageHint, false);
+			}
+			return *this;
+		}
+
+		~AlignedBuffer() override = default;
+
+		/// Check whether the buffer was successfully marked to be backed by transparent huge pages
+		[[nodiscard]] bool hugePagesQ() const noexcept {
+			return hugePageHint;
+		}
+
+		/**
+		 * @brief   Copy data into a new flat NumericArray
+		 * @return  NumericArray owned by the library
+		 */
+		NumericArray<T> toNumericArray() const {
+			return toNumericArray({length});
+		}
+
+		/**
+		 * @brief   Copy data into a new NumericArray of given dimensions
+		 * @param   dims - dimensions of the NumericArray, total number of elements must be equal to the size of the buffer
+		 * @return  NumericArray owned by the library
+		 * @throws  ErrorName::DimensionsError - if \p dims do not match the size of the buffer
+		 */
+		NumericArray<T> toNumericArray(MArrayDimensions dims) const {
+			if (dims.flatCount() != length) {
+				ErrorManager::throwExceptionWithDebugInfo(ErrorName::DimensionsError, "Dimensions do not match the size of AlignedBuffer");
+			}
+			return {this->cbegin(), this->cend(), std::move(dims)};
+		}
+
+	private:
+		/// Deleter which remembers the alignment passed to operator new
+		struct AlignedDelete {
+			std::size_t alignment = CacheLineSize;
+
+			void operator()(T* p) const noexcept {
+				::operator delete(p, std::align_val_t {alignment});
+			}
+		};
+
+		void allocate(bool hugePages) {
+			std::size_t bytes = static_cast<std::size_t>(length) * sizeof(T);
+			if (bytes == 0) {
+				return;
+			}
+			std::size_t alignment = CacheLineSize;
+			const bool useHugePages = hugePages && bytes >= HugePageThreshold;
+			if (useHugePages) {
+				alignment = HugePageSize;
+				bytes = (bytes + HugePageSize - 1) / HugePageSize * HugePageSize;
+			}
+			buffer = std::unique_ptr<T, AlignedDelete> {static_cast<T*>(::operator new(bytes, std::align_val_t {alignment})), AlignedDelete {alignment}};
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+			hugePageHint = useHugePages && madvise(buffer.get(), bytes, MADV_HUGEPAGE) == 0;
+#endif
+		}
+
+		T* getData() const noexcept override {
+			return buffer.get();
+		}
+
+		mint getSize() const noexcept override {
+			return length;
+		}
+
+		std::unique_ptr<T, AlignedDelete> buffer;
+		mint length = 0;
+		bool hugePageHint = false;
+	};
+
+	/// Split of a range of elements into a scalar head, a body of full aligned blocks and a scalar tail
+	struct AlignedSplit {
+		/// Number of elements before the first aligned address
+		mint head;
+		/// Number of elements in full blocks, a multiple of the block length
+		mint body;
+		/// Number of remaining elements
+		mint tail;
+	};
+
+	/**
+	 * @brief   Split \p n elements starting at \p data so that the body starts at an address aligned to \p Alignment bytes
+	 * @tparam  Lanes - length of a block, the body length is a multiple of it
+	 * @tparam  Alignment - required alignment of the body in bytes
+	 * @param   data - pointer to the first element
+	 * @param   n - number of elements
+	 * @return  lengths of the head, body and tail
+	 */
+	template<mint Lanes, std::size_t Alignment = CacheLineSize, typename T>
+	AlignedSplit splitAligned(const T* data, mint n) noexcept {
+		static_assert(Lanes > 0, "Block length must be positive.");
+		const auto address = reinterpret_cast<std::uintptr_t>(data);
+		mint head = 0;
+		if (address % alignof(T) == 0) {
+			const auto misalignment = static_cast<mint>((Alignment - address % Alignment) % Alignment);
+			head = (misalignment % static_cast<mint>(sizeof(T)) == 0) ? misalignment / static_cast<mint>(sizeof(T)) : n;
+		} else {
+			head = n;
+		}
+		head = std::min(head, n);
+		const mint body = (n - head) / Lanes * Lanes;
+		return {head, body, n - head - body};
+	}
+
+	/**
+	 * @brief   Process \p n elements starting at \p data with a peeled loop: \p scalar is called for single elements before and after the aligned part
+	 *          and \p block for every block of \p Lanes elements starting at an address aligned to \p Alignment bytes.
+	 * @tparam  Lanes - number of elements processed by a single call to \p block
+	 * @tparam  Alignment - alignment of the first element of every block, in bytes
+	 * @param   data - pointer to the first element, it does not need to be aligned
+	 * @param   n - number of elements
+	 * @param   scalar - callable taking an index of a single element
+	 * @param   block - callable taking an index of the first element of a block of \p Lanes elements
+	 * @note    If \p data is not aligned to the element size, all elements are processed by \p scalar.
+	 */
+	template<mint Lanes, std::size_t Alignment = CacheLineSize, typename T, typename Scalar, typename Block>
+	void alignedLoop(const T* data, mint n, Scalar&& scalar, Block&& block) {
+		const auto split = splitAligned<Lanes, Alignment>(data, n);
+		mint i = 0;
+		for (; i < split.head; ++i) {
+			scalar(i);
+		}
+		for (const mint bodyEnd = split.head + split.body; i < bodyEnd; i += Lanes) {
+			block(i);
+		}
+		for (; i < n; ++i) {
+			scalar(i);
+		}
+	}
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_ALIGNEDBUFFER_HPP
@@ -0,0 +1,54 @@
+/**
+ * @file	BlockCodec.h
+ * @brief	Self-contained lossless compression of blocks of numeric data: byte shuffle followed by a fast LZ77 coder.
+ *
+ * Numeric data rarely compresses well byte by byte, but bytes of the same significance in neighboring elements are often equal (high bytes of small
+ * integers, exponents of floating-point numbers of similar magnitude). The byte shuffle groups the i-th bytes of all elements together, which turns
+ * them into long runs that the LZ coder handles well. The LZ coder uses the sequence format of LZ4 (a token with literal and match lengths, literals,
+ * a 16-bit match offset), which favors speed over compression ratio.
+ */
+#ifndef LLU_CONTAINERS_BLOCKCODEC_H
+#define LLU_CONTAINERS_BLOCKCODEC_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace LLU {
+
+	/// Compression method of blocks of data
+	enum struct Compression : std::uint8_t {
+		None,	   ///< Data is stored as is
+		ShuffleLZ  ///< Byte shuffle followed by the LZ coder, see compressBlock
+	};
+
+	/**
+	 * @brief   Get the maximal size of compressed data
+	 * @param   count - number of bytes to compress
+	 * @return  size of a buffer which is always large enough for the result of compressBlock
+	 */
+	std::size_t compressBound(std::size_t count) noexcept;
+
+	/**
+	 * @brief   Compress a block of elements
+	 * @param   src - data to compress
+	 * @param   count - number of bytes of data
+	 * @param   dst - buffer for at least compressBound(count) bytes
+	 * @param   elementSize - size of a single element in bytes, used by the byte shuffle
+	 * @return  number of bytes written to \p dst
+	 */
+	std::size_t compressBlock(const void* src, std::size_t count, void* dst, std::size_t elementSize = 1);
+
+	/**
+	 * @brief   Decompress a block of elements compressed with compressBlock
+	 * @param   src - compressed data
+	 * @param   srcCount - number of bytes of compressed data
+	 * @param   dst - buffer for the decompressed data
+	 * @param   count - size of the decompressed data in bytes, as passed to compressBlock
+	 * @param   elementSize - size of a single element in bytes, as passed to compressBlock
+	 * @throws  ErrorName::DecompressionFailed - if the compressed data is corrupted
+	 */
+	void decompressBlock(const void* src, std::size_t srcCount, void* dst, std::size_t count, std::size_t elementSize = 1);
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_BLOCKCODEC_H
@@ -0,0 +1,435 @@
+/**
+ * @file	ChunkedFile.hpp
+ * @brief	Block-based binary file format for NumericArrays and Tensors, read and written in parallel.
+ *
+ * A chunked file starts with a header (magic bytes "LLUC", version, flags, numericarray_data_t type code, rank, block size and dimensions),
+ * optionally followed by a table of 64-bit checksums, one per block. Then come the elements of the array in row-major order, split into blocks
+ * of a fixed number of bytes (the last block may be shorter). Every block is at a known position in the file, so blocks can be read and written
+ * independently with positional I/O (readAt and writeAt) from many threads, and verified against their checksums.
+ *
+ * Blocks may also be compressed with one of the methods from BlockCodec.h. Compressed blocks have different sizes, so the header is then followed by
+ * a table with the position and size of every block, which still allows blocks to be read in any order. Blocks are compressed and decompressed
+ * by the threads which write and read them, so compression runs in parallel as well. Files with compressed blocks have format version 2, while
+ * uncompressed files keep version 1 and remain readable by readers that do not know about compression.
+ *
+ * @code
+ * 	LLU_LIBRARY_FUNCTION(LoadArray) {
+ * 		LLU::ThreadPool pool;
+ * 		LLU::ChunkedFileReader reader {mngr.getString(0)};
+ * 		mngr.set(reader.read<double>(pool));
+ * 	}
+ * @endcode
+ */
+#ifndef LLU_CONTAINERS_CHUNKEDFILE_HPP
+#define LLU_CONTAINERS_CHUNKEDFILE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "LLU/Async/Utilities.h"
+#include "LLU/Containers/BlockCodec.h"
+#include "LLU/Containers/MArray.hpp"
+#include "LLU/Containers/MArrayDimensions.h"
+#include "LLU/Containers/NumericArray.h"
+#include "LLU/Containers/Tensor.h"
+#include "LLU/Containers/Views/NumericArray.hpp"
+#include "LLU/Containers/Views/Tensor.hpp"
+#include "LLU/ErrorLog/ErrorManager.h"
+#include "LLU/FileUtilities.h"
+
+namespace LLU {
+
+	/// @cond
+	namespace Detail {
+		/// Process \p count items in \p taskCount interleaved tasks, one of them in the calling thread and the others on a thread pool
+		template<typename Pool, typename F>
+		void forEachInTasks(Pool& pool, unsigned taskCount, mint count, F f) {
+			const mint tasks = std::clamp<mint>(taskCount, 1, std::max<mint>(count, 1));
+			Async::runTasks(pool, static_cast<std::size_t>(tasks), [&f, count, tasks](std::size_t task) {
+				for (auto i = static_cast<mint>(task); i < count; i += tasks) {
+					f(i);
+				}
+			});
+		}
+	}  // namespace Detail
+	/// @endcond
+
+	/**
+	 * @brief   Compute a 64-bit checksum of a range of bytes
+	 * @param   data - pointer to the first byte
+	 * @param   count - number of bytes
+	 * @return  checksum, equal for equal ranges and different with high probability for different ones
+	 * @note    This is a fast non-cryptographic hash processing 8 bytes at a time. It detects corrupted data, but not deliberate tampering.
+	 */
+	std::uint64_t checksum64(const void* data, std::size_t count) noexcept;
+
+	/// Parameters of a new chunked file
+	struct ChunkedFileOptions {
+		/// Size of a block in bytes, rounded down to a multiple of the element size
+		std::size_t blockSize = std::size_t {4} << 20U;
+
+		/// Whether to store and verify a checksum of every block
+		bool checksums = true;
+
+		/// Compression of blocks, blocks which do not get smaller are stored uncompressed
+		Compression compression = Compression::None;
+	};
+
+	/// Layout of a chunked file
+	struct ChunkedFileHeader {
+		/// Type of elements
+		numericarray_data_t type;
+
+		/// Dimensions of the array
+		MArrayDimensions dims;
+
+		/// Size of a block in bytes
+		std::size_t blockSize;
+
+		/// Whether the file contains a checksum of every block
+		bool checksums;
+
+		/// Compression of blocks
+		Compression compression;
+
+		/// Position and size of a compressed block in the file
+		struct Block {
+			std::uint64_t offset;
+			std::uint64_t size;
+		};
+
+		/// Get the size of a single element in bytes
+		[[nodiscard]] std::size_t elementSize() const;
+
+		/// Get the total size of the array data in bytes
+		[[nodiscard]] std::size_t dataSize() const;
+
+		/// Get the number of blocks
+		[[nodiscard]] mint blockCount() const;
+
+		/// Get the size of block \p index in bytes
+		[[nodiscard]] std::size_t blockBytes(mint index) const;
+
+		/// Get the position of the checksum table in the file
+		[[nodiscard]] std::uint64_t checksumOffset() const noexcept;
+
+		/// Get the position of the table of compressed blocks in the file
+		[[nodiscard]] std::uint64_t blockTableOffset() const;
+
+		/// Get the position of the first block in the file, blocks of uncompressed files follow each other from there
+		[[nodiscard]] std::uint64_t dataOffset() const;
+	};
+
+	/**
+	 * @brief   Reader of chunked files
+	 *
+	 * All member functions are const and can be called concurrently, in particular different blocks can be read in parallel.
+	 */
+	class ChunkedFileReader {
+	public:
+		/**
+		 * @brief   Open a chunked file and read its header
+		 * @param   fileName - path to the file, it is validated with validatePath
+		 * @throws  ErrorName::OpenFileFailed - if the file cannot be opened
+		 * @throws  ErrorName::InvalidArrayFileHeader - if the file does not start with a valid header
+		 */
+		explicit ChunkedFileReader(const std::string& fileName);
+
+		/// Get the layout of the file
+		[[nodiscard]] const ChunkedFileHeader& header() const noexcept {
+			return hdr;
+		}
+
+		/// Get the dimensions of the stored array
+		[[nodiscard]] const MArrayDimensions& dimensions() const noexcept {
+			return hdr.dims;
+		}
+
+		/// Get the number of bytes the array data takes in the file, smaller than header().dataSize() for compressed files
+		[[nodiscard]] std::uint64_t storedSize() const noexcept;
+
+		/**
+		 * @brief   Read a single block, decompress it if needed and verify its checksum
+		 * @param   index - index of the block
+		 * @param   buffer - memory for header().blockBytes(index) bytes
+		 * @throws  ErrorName::ReadFileFailed - if the block could not be read
+		 * @throws  ErrorName::DecompressionFailed - if the compressed block is corrupted
+		 * @throws  ErrorName::ChecksumMismatch - if the data does not match the stored checksum
+		 */
+		void readBlock(mint index, void* buffer) const;
+
+		/**
+		 * @brief   Read the whole array into a preallocated NumericArray or Tensor, block after block in the calling thread
+		 * @param   dst - NumericArray or Tensor of the same type and dimensions as the stored array
+		 * @throws  ErrorName::NumericArrayTypeError - if the type of \p dst does not match the file
+		 * @throws  ErrorName::DimensionsError - if the dimensions of \p dst do not match the file
+		 */
+		template<typename T>
+		void readInto(MArray<T>& dst) const {
+			auto* bytes = checkDestination(dst);
+			for (mint b = 0; b < hdr.blockCount(); ++b) {
+				readBlock(b, bytes + static_cast<std::size_t>(b) * hdr.blockSize);
+			}
+		}
+
+		/**
+		 * @brief   Read the whole array into a preallocated NumericArray or Tensor, loading (and decompressing) blocks in parallel on a thread pool
+		 * @param   dst - NumericArray or Tensor of the same type and dimensions as the stored array
+		 * @param   pool - thread pool, for example LLU::ThreadPool or LLU::BasicPool
+		 * @param   taskCount - number of tasks, by default the number of hardware threads
+		 * @note    The calling thread reads its share of blocks too, so this function must not be called from a task running on the same pool.
+		 */
+		template<typename T, typename Pool>
+		void readInto(MArray<T>& dst, Pool& pool, unsigned taskCount = std::thread::hardware_concurrency()) const {
+			auto* bytes = checkDestination(dst);
+			Detail::forEachInTasks(pool, taskCount, hdr.blockCount(),
+								   [this, bytes](mint b) { readBlock(b, bytes + static_cast<std::size_t>(b) * hdr.blockSize); });
+		}
+
+		/**
+		 * @brief   Read the whole array into a new NumericArray
+		 * @tparam  T - type of elements, must match the type stored in the file
+		 * @return  NumericArray owned by the library
+		 */
+		template<typename T>
+		NumericArray<T> read() const {
+			auto res = allocate<T>();
+			readInto(res);
+			return res;
+		}
+
+		/**
+		 * @brief   Read the whole array into a new NumericArray, loading blocks in parallel on a thread pool
+		 * @tparam  T - type of elements, must match the type stored in the file
+		 * @param   pool - thread pool, for example LLU::ThreadPool or LLU::BasicPool
+		 * @return  NumericArray owned by the library
+		 */
+		template<typename T, typename Pool>
+		NumericArray<T> read(Pool& pool) const {
+			auto res = allocate<T>();
+			readInto(res, pool);
+			return res;
+		}
+
+		/**
+		 * @brief   Read the whole array into a new Tensor
+		 * @tparam  T - type of elements, one of mint, double and std::complex<double>, must match the type stored in the file
+		 * @return  Tensor owned by the library
+		 */
+		template<typename T>
+		Tensor<T> readTensor() const {
+			auto res = allocateTensor<T>();
+			readInto(res);
+			return res;
+		}
+
+		/**
+		 * @brief   Read the whole array into a new Tensor, loading blocks in parallel on a thread pool
+		 * @tparam  T - type of elements, one of mint, double and std::complex<double>, must match the type stored in the file
+		 * @param   pool - thread pool, for example LLU::ThreadPool or LLU::BasicPool
+		 * @return  Tensor owned by the library
+		 */
+		template<typename T, typename Pool>
+		Tensor<T> readTensor(Pool& pool) const {
+			auto res = allocateTensor<T>();
+			readInto(res, pool);
+			return res;
+		}
+
+		/**
+		 * @brief   Stream the blocks in order through a callback, while the following blocks are being loaded on a thread pool
+		 * @tparam  T - type of elements, must match the type stored in the file
+		 * @param   pool - thread pool which loads the blocks
+		 * @param   f - callable taking the block index, a pointer to its first element and the number of elements, called in the calling thread
+		 * @param   depth - maximal number of blocks loaded in advance
+		 * @note    Only \p depth + 1 blocks are kept in memory at a time, so arrays larger than the available memory can be processed.
+		 */
+		template<typename T, typename Pool, typename F>
+		void forEachBlock(Pool& pool, F&& f, mint depth = 4) const {
+			checkType<T>();
+			const mint blocks = hdr.blockCount();
+			std::deque<std::pair<std::vector<T>, std::future<void>>> inFlight;
+			mint next = 0;
+			auto schedule = [&] {
+				std::vector<T> buffer(hdr.blockBytes(next) / sizeof(T));
+				auto* data = buffer.data();
+				inFlight.emplace_back(std::move(buffer), pool.submit([this, data, b = next] { readBlock(b, data); }));
+				++next;
+			};
+			try {
+				for (mint b = 0; b < blocks; ++b) {
+					while (next < blocks && next <= b + std::max<mint>(depth, 0)) {
+						schedule();
+					}
+					auto& [buffer, fut] = inFlight.front();
+					fut.get();
+					f(b, static_cast<const T*>(buffer.data()), static_cast<mint>(buffer.size()));
+					inFlight.pop_front();
+				}
+			} catch (...) {
+				// wait for reads still in progress, they write into buffers owned by this function
+				for (auto& pending : inFlight) {
+					if (pending.second.valid()) {
+						pending.second.wait();
+					}
+				}
+				throw;
+			}
+		}
+
+	private:
+		template<typename T>
+		void checkType() const {
+			if (NumericArrayType<T> != hdr.type) {
+				ErrorManager::throwException(ErrorName::NumericArrayTypeError);
+			}
+		}
+
+		template<typename T>
+		std::byte* checkDestination(MArray<T>& dst) const {
+			checkType<T>();
+			if (dst.dimensions().get() != hdr.dims.get()) {
+				ErrorManager::throwExceptionWithDebugInfo(ErrorName::DimensionsError, "Dimensions of the array do not match file " + name);
+			}
+			return reinterpret_cast<std::byte*>(dst.data());	// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast): blocks are copied byte-wise
+		}
+
+		template<typename T>
+		NumericArray<T> allocate() const {
+			checkType<T>();
+			return NumericArray<T> {GenericNumericArray {hdr.type, hdr.dims.rank(), hdr.dims.data()}};
+		}
+
+		template<typename T>
+		Tensor<T> allocateTensor() const {
+			checkType<T>();
+			return Tensor<T> {GenericTensor {TensorType<T>, hdr.dims.rank(), hdr.dims.data()}};
+		}
+
+		FilePtr file;
+		std::string name;
+		ChunkedFileHeader hdr;
+		std::vector<std::uint64_t> sums;
+		std::vector<ChunkedFileHeader::Block> blocks;
+	};
+
+	/**
+	 * @brief   Writer of chunked files
+	 *
+	 * Blocks can be written in any order and concurrently from many threads. The checksum table and the table of compressed blocks are written
+	 * by finish(), which must be called after all blocks have been written.
+	 */
+	class ChunkedFileWriter {
+	public:
+		/**
+		 * @brief   Create a new chunked file (or truncate an existing one) and write its header
+		 * @param   fileName - path to the file, it is validated with validatePath
+		 * @param   type - type of elements
+		 * @param   dims - dimensions of the array
+		 * @param   opts - block size, checksum and compression settings
+		 * @throws  ErrorName::OpenFileFailed - if the file cannot be opened
+		 */
+		ChunkedFileWriter(const std::string& fileName, numericarray_data_t type, MArrayDimensions dims, ChunkedFileOptions opts = {});
+
+		/// Get the layout of the file
+		[[nodiscard]] const ChunkedFileHeader& header() const noexcept {
+			return hdr;
+		}
+
+		/**
+		 * @brief   Compress a single block if requested, write it and remember its checksum
+		 * @param   index - index of the block
+		 * @param   buffer - header().blockBytes(index) bytes of data
+		 * @throws  ErrorName::WriteFileFailed - if the block could not be written
+		 */
+		void writeBlock(mint index, const void* buffer);
+
+		/**
+		 * @brief   Write the checksum table and the table of compressed blocks, and flush the file
+		 * @throws  ErrorName::WriteFileFailed - if the data could not be written
+		 */
+		void finish();
+
+		/**
+		 * @brief   Write all blocks of a NumericArray in the calling thread and finish the file
+		 * @param   na - NumericArray of the type and dimensions passed to the constructor
+		 */
+		void write(const NumericArrayView& na) {
+			checkSource(na.type(), na.getDimensions(), na.getRank());
+			writeAll(na.rawData());
+		}
+
+		/**
+		 * @brief   Write all blocks of a NumericArray in parallel on a thread pool and finish the file
+		 * @param   na - NumericArray of the type and dimensions passed to the constructor
+		 * @param   pool - thread pool, for example LLU::ThreadPool or LLU::BasicPool
+		 * @param   taskCount - number of tasks, by default the number of hardware threads
+		 * @note    The calling thread writes its share of blocks too, so this function must not be called from a task running on the same pool.
+		 */
+		template<typename Pool>
+		void write(const NumericArrayView& na, Pool& pool, unsigned taskCount = std::thread::hardware_concurrency()) {
+			checkSource(na.type(), na.getDimensions(), na.getRank());
+			writeAll(na.rawData(), pool, taskCount);
+		}
+
+		/**
+		 * @brief   Write all blocks of a Tensor in the calling thread and finish the file
+		 * @param   t - Tensor with the dimensions passed to the constructor, the type passed to the constructor must be the NumericArray type
+		 *              of the same elements (MNumericArray_Type_Bit64, MNumericArray_Type_Real64 or MNumericArray_Type_Complex_Real64)
+		 */
+		void write(const TensorView& t) {
+			checkSource(tensorElementType(t.type()), t.getDimensions(), t.getRank());
+			writeAll(t.rawData());
+		}
+
+		/**
+		 * @brief   Write all blocks of a Tensor in parallel on a thread pool and finish the file
+		 * @param   t - Tensor with the dimensions passed to the constructor, see write(const TensorView&)
+		 * @param   pool - thread pool, for example LLU::ThreadPool or LLU::BasicPool
+		 * @param   taskCount - number of tasks, by default the number of hardware threads
+		 */
+		template<typename Pool>
+		void write(const TensorView& t, Pool& pool, unsigned taskCount = std::thread::hardware_concurrency()) {
+			checkSource(tensorElementType(t.type()), t.getDimensions(), t.getRank());
+			writeAll(t.rawData(), pool, taskCount);
+		}
+
+	private:
+		void writeAll(const void* data) {
+			const auto* bytes = static_cast<const std::byte*>(data);
+			for (mint b = 0; b < hdr.blockCount(); ++b) {
+				writeBlock(b, bytes + static_cast<std::size_t>(b) * hdr.blockSize);
+			}
+			finish();
+		}
+
+		template<typename Pool>
+		void writeAll(const void* data, Pool& pool, unsigned taskCount) {
+			const auto* bytes = static_cast<const std::byte*>(data);
+			Detail::forEachInTasks(pool, taskCount, hdr.blockCount(),
+								   [this, bytes](mint b) { writeBlock(b, bytes + static_cast<std::size_t>(b) * hdr.blockSize); });
+			finish();
+		}
+
+		static numericarray_data_t tensorElementType(mint tensorType);
+
+		void checkSource(numericarray_data_t type, const mint* dims, mint rank) const;
+
+		FilePtr file;
+		std::string name;
+		ChunkedFileHeader hdr;
+		std::vector<std::uint64_t> sums;
+		std::vector<ChunkedFileHeader::Block> blocks;
+		std::atomic<std::uint64_t> end;
+	};
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_CHUNKEDFILE_HPP
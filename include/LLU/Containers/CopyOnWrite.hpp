@@ -0,0 +1,182 @@
+/**
+ * @file	CopyOnWrite.hpp
+ * @brief	Wrapper over Shared NumericArrays and Tensors which copies the data only when it is about to be modified.
+ *
+ * Containers passed as "Shared" give direct access to the memory of the Kernel expression, so a library function which may need to modify
+ * its argument has to clone it first. Doing this unconditionally wastes a copy in all the calls where the argument is only read.
+ * CopyOnWrite defers the clone until the first access through a mutating member function, e.g. non-const begin() or operator[],
+ * and skips it altogether if the wrapped container is already exclusively owned by the library.
+ *
+ * @code
+ * 	LLU_LIBRARY_FUNCTION(ClampNegative) {
+ * 		LLU::CopyOnWrite<LLU::NumericArray<double>> cow {mngr.getNumericArray<double, LLU::Passing::Shared>(0)};
+ * 		for (mint i = 0; i < cow.size(); ++i) {
+ * 			if (cow.read()[i] < 0) {
+ * 				cow[i] = 0;	   // the first write clones the shared array
+ * 			}
+ * 		}
+ * 		mngr.set(cow.read());
+ * 	}
+ * @endcode
+ */
+#ifndef LLU_CONTAINERS_COPYONWRITE_HPP
+#define LLU_CONTAINERS_COPYONWRITE_HPP
+
+#include <utility>
+
+#include "LLU/Containers/Generic/Base.hpp"
+#include "LLU/Containers/MArrayDimensions.h"
+
+namespace LLU {
+
+	/**
+	 * @brief   Typed container wrapper with copy-on-write semantics
+	 *
+	 * All const member functions give zero-copy access to the wrapped container. Non-const member functions which expose the data
+	 * (write(), data(), begin(), end(), operator[], at()) first make sure that the container can be modified without affecting anyone else
+	 * and clone it otherwise. The container is modified in place only if it is owned by the library and its share count is 0.
+	 * Containers owned by LibraryLink (passed as Automatic or "Constant") are cloned as well, because LLU cannot tell which of the two
+	 * passing modes was used.
+	 *
+	 * @tparam  Container - typed container with a clone() member function, e.g. NumericArray<T>, Tensor<T> or Image<T>
+	 * @note    On a non-const CopyOnWrite object also the loops that only read the data select the mutating overloads of begin() and end().
+	 *          Use read(), cbegin() and cend() or std::as_const in such loops to avoid the copy.
+	 */
+	template<class Container>
+	class CopyOnWrite {
+	public:
+		/// Type of elements of the wrapped container
+		using value_type = typename Container::value_type;
+
+		/// Iterator type
+		using iterator = typename Container::iterator;
+
+		/// Constant iterator type
+		using const_iterator = typename Container::const_iterator;
+
+		/// Reference type
+		using reference = typename Container::reference;
+
+		/// Constant reference type
+		using const_reference = typename Container::const_reference;
+
+		/**
+		 * @brief   Wrap a container, no data is copied
+		 * @param   c - container to wrap, typically obtained from MArgumentManager with Passing::Shared
+		 */
+		explicit CopyOnWrite(Container c) : cont {std::move(c)} {}
+
+		/// Get read-only access to the wrapped container
+		const Container& read() const noexcept {
+			return cont;
+		}
+
+		/**
+		 * @brief   Get a reference to the container which can be safely modified, cloning the wrapped container if needed
+		 * @return  reference to a container exclusively owned by the library
+		 */
+		Container& write() {
+			detach();
+			return cont;
+		}
+
+		/// Check whether the wrapped container can be modified without making a copy
+		[[nodiscard]] bool exclusiveQ() const noexcept {
+			return cont.getOwner() == Ownership::Library && cont.shareCount() == 0;
+		}
+
+		/// Check whether the wrapped container has been cloned by this wrapper
+		[[nodiscard]] bool copiedQ() const noexcept {
+			return copied;
+		}
+
+		/// Get the total number of elements
+		mint size() const noexcept {
+			return cont.size();
+		}
+
+		/// Get the rank of the container
+		mint rank() const noexcept {
+			return cont.rank();
+		}
+
+		/// Get the dimensions of the container
+		const MArrayDimensions& dimensions() const {
+			return cont.dimensions();
+		}
+
+		/// Get read-only pointer to the data, no copy is made
+		const value_type* data() const noexcept {
+			return cont.data();
+		}
+
+		/// Get pointer to the data which can be modified, clones the container if needed
+		value_type* data() {
+			return write().data();
+		}
+
+		/// Get constant iterator to the first element, no copy is made
+		const_iterator begin() const noexcept {
+			return cont.cbegin();
+		}
+
+		/// Get iterator to the first element, clones the container if needed
+		iterator begin() {
+			return write().begin();
+		}
+
+		/// Get constant iterator to the first element, no copy is made
+		const_iterator cbegin() const noexcept {
+			return cont.cbegin();
+		}
+
+		/// Get constant iterator past the last element, no copy is made
+		const_iterator end() const noexcept {
+			return cont.cend();
+		}
+
+		/// Get iterator past the last element, clones the container if needed
+		iterator end() {
+			return write().end();
+		}
+
+		/// Get constant iterator past the last element, no copy is made
+		const_iterator cend() const noexcept {
+			return cont.cend();
+		}
+
+		/// Get constant reference to the element at \p index, no copy is made
+		const_reference operator[](mint index) const {
+			return cont[index];
+		}
+
+		/// Get reference to the element at \p index, clones the container if needed
+		reference operator[](mint index) {
+			return write()[index];
+		}
+
+		/// Get constant reference to the element at \p index with bound checking, no copy is made
+		const_reference at(mint index) const {
+			return cont.at(index);
+		}
+
+		/// Get reference to the element at \p index with bound checking, clones the container if needed
+		reference at(mint index) {
+			return write().at(index);
+		}
+
+	private:
+		void detach() {
+			if (!exclusiveQ()) {
+				cont = cont.clone();
+				copied = true;
+			}
+		}
+
+		Container cont;
+		bool copied = false;
+	};
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_COPYONWRITE_HPP
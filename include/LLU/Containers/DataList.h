@@ -9,6 +9,8 @@
 #define LLU_CONTAINERS_DATALIST_H
 
 #include <initializer_list>
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -16,6 +18,7 @@
 
 #include "LLU/Containers/Generic/DataStore.hpp"
 #include "LLU/Containers/Iterators/DataList.hpp"
+#include "LLU/Containers/NumericArray.h"
 #include "LLU/ErrorLog/ErrorManager.h"
 #include "LLU/LibraryData.h"
 #include "LLU/MArgument.h"
@@ -25,6 +28,44 @@ namespace LLU {
 
 	namespace NodeType = Argument::Typed;
 
+	/// Describes when the node types of a DataList created from a GenericDataList are checked against the DataList value type
+	enum struct DataListValidation {
+		Eager,	   ///< All nodes are checked when the DataList is created, so that iteration decodes nodes without any further checks
+		OnAccess,  ///< Each node is checked when it is decoded, which fuses validation with the first iteration and skips the extra pass
+		Skip	   ///< Node types are not checked at all, decoding a node of different type than T is undefined behavior
+	};
+
+	/// @cond
+	namespace Detail {
+		/// Get a pair of LibraryLink functions that add a nameless and a named node of given type to a DataStore
+		template<MArgumentType Type>
+		auto dataStoreAdders(const st_WolframIOLibrary_Functions* api) {
+			if constexpr (Type == MArgumentType::Boolean) {
+				return std::make_pair(api->DataStore_addBoolean, api->DataStore_addNamedBoolean);
+			} else if constexpr (Type == MArgumentType::Integer) {
+				return std::make_pair(api->DataStore_addInteger, api->DataStore_addNamedInteger);
+			} else if constexpr (Type == MArgumentType::Real) {
+				return std::make_pair(api->DataStore_addReal, api->DataStore_addNamedReal);
+			} else if constexpr (Type == MArgumentType::Complex) {
+				return std::make_pair(api->DataStore_addComplex, api->DataStore_addNamedComplex);
+			} else if constexpr (Type == MArgumentType::Tensor) {
+				return std::make_pair(api->DataStore_addMTensor, api->DataStore_addNamedMTensor);
+			} else if constexpr (Type == MArgumentType::SparseArray) {
+				return std::make_pair(api->DataStore_addMSparseArray, api->DataStore_addNamedMSparseArray);
+			} else if constexpr (Type == MArgumentType::NumericArray) {
+				return std::make_pair(api->DataStore_addMNumericArray, api->DataStore_addNamedMNumericArray);
+			} else if constexpr (Type == MArgumentType::Image) {
+				return std::make_pair(api->DataStore_addMImage, api->DataStore_addNamedMImage);
+			} else if constexpr (Type == MArgumentType::UTF8String) {
+				return std::make_pair(api->DataStore_addString, api->DataStore_addNamedString);
+			} else {
+				static_assert(Type == MArgumentType::DataStore, "Unsupported DataStore node type.");
+				return std::make_pair(api->DataStore_addDataStore, api->DataStore_addNamedDataStore);
+			}
+		}
+	}  // namespace Detail
+	/// @endcond
+
 	/**
 	 * @class   DataList
 	 * @brief   Top-level wrapper over LibraryLink's DataStore.
@@ -53,11 +94,18 @@ namespace LLU {
 	public:
 		using GenericDataList::GenericDataList; // NOLINT(modernize-use-equals-default): false positive
 
+		/**
+		 * @brief   Create an empty DataList
+		 */
+		DataList() : typesValidated {true} {}
+
 		/**
 		 * @brief	Create DataList wrapping around an existing GenericDataList
 		 * @param 	gds - GenericDataList
+		 * @param 	validation - when to check that all nodes have values of type T
+		 * @throws 	ErrorName::DLInvalidNodeType - if validation is Eager and some node has value of different type than T
 		 */
-		explicit DataList(GenericDataList gds);
+		explicit DataList(GenericDataList gds, DataListValidation validation = DataListValidation::Eager);
 
 		/**
 		 * @brief	Create DataList from list of values. Keys will be set to empty strings.
@@ -73,6 +121,29 @@ namespace LLU {
 		 */
 		DataList(std::initializer_list<std::pair<std::string, value_type>> initList);
 
+		/**
+		 * @brief   Create DataList with nameless nodes holding values from a range.
+		 * @tparam  InputIt - input iterator over values convertible to T, use std::move_iterator to move containers into the DataList
+		 * @param   first - iterator to the first value
+		 * @param   last - iterator past the last value
+		 * @return  new DataList with one node per value
+		 * @note    The LibraryLink function that adds nodes is resolved once for the whole range, which makes this much faster than repeated push_back.
+		 */
+		template<typename InputIt>
+		static DataList fromRange(InputIt first, InputIt last);
+
+		/**
+		 * @brief   Create DataList with named nodes, taking names and values from two ranges of the same length.
+		 * @tparam  NameIt - input iterator over names convertible to std::string_view
+		 * @tparam  ValueIt - input iterator over values convertible to T
+		 * @param   firstName - iterator to the first name
+		 * @param   lastName - iterator past the last name
+		 * @param   firstValue - iterator to the first value, there must be at least as many values as names
+		 * @return  new DataList with one node per name
+		 */
+		template<typename NameIt, typename ValueIt>
+		static DataList fromNamedRange(NameIt firstName, NameIt lastName, ValueIt firstValue);
+
 		/**
 		 * @brief   Clone this DataList, performing a deep copy of the underlying DataStore.
 		 * @note    The cloned DataStore always belongs to the library (Ownership::Library) because LibraryLink has no idea of its existence.
@@ -84,7 +155,7 @@ namespace LLU {
 		 *	@brief Get iterator at the beginning of underlying data
 		 **/
 		iterator begin() const {
-			return iterator {front()};
+			return iterator {front(), !typesValidated};
 		}
 
 		/**
@@ -112,7 +183,7 @@ namespace LLU {
 		 * @brief   Get proxy iterator over node values pointing to the first node.
 		 */
 		value_iterator valueBegin() const {
-			return value_iterator {front()};
+			return value_iterator {front(), !typesValidated};
 		}
 
 		/**
@@ -136,6 +207,46 @@ namespace LLU {
 			return name_iterator {nullptr};
 		}
 
+		/**
+		 * @brief   Get value of the node at given position.
+		 * @param   position - index of a node, must be smaller than length()
+		 * @return  value of the node at given position
+		 * @note    The first positional or by-name access builds an index of all nodes, so that subsequent lookups take constant time.
+		 *          Nodes added with push_back are added to the index, but nodes added to the underlying DataStore by other means are not.
+		 */
+		value_type operator[](mint position) const {
+			return decode(getIndex()[position]);
+		}
+
+		/**
+		 * @brief   Get value of the node at given position, with bounds checking.
+		 * @param   position - index of a node
+		 * @return  value of the node at given position
+		 * @throws  ErrorName::DLIndexError - if \p position is out of range
+		 */
+		value_type at(mint position) const {
+			return decode(getIndex().at(position));
+		}
+
+		/**
+		 * @brief   Find the first node with given name.
+		 * @param   name - node name
+		 * @return  iterator pointing to the first node with given name, or end() if there is no such node
+		 * @note    The hash table of node names is built on the first call, so that subsequent lookups take constant time on average.
+		 */
+		iterator find(std::string_view name) const {
+			return iterator {getIndex().find(name), !typesValidated};
+		}
+
+		/**
+		 * @brief   Check if there is a node with given name.
+		 * @param   name - node name
+		 * @return  true iff the DataList has a node with given name
+		 */
+		bool contains(std::string_view name) const {
+			return getIndex().find(name) != nullptr;
+		}
+
 		/**
 		 * @brief 	Add new node to the DataList.
 		 * @param 	nodeData - actual data to store in the new node
@@ -149,6 +260,37 @@ namespace LLU {
 		 */
 		void push_back(std::string_view name, value_type nodeData);
 
+		/**
+		 * @brief   Move all nodes of another DataList to the end of this one.
+		 * @param   other - DataList whose nodes are moved, it is left empty
+		 * @note    If this DataList is empty, it takes over the DataStore of \p other and nothing is copied. Otherwise each node value is copied once,
+		 *          see GenericDataList::append for details. Appending a DataList to itself does nothing.
+		 */
+		void append(DataList&& other);
+
+		/**
+		 * @brief   Move a whole DataList into a new node of this DataList, without copying any of its nodes.
+		 * @tparam  U - node type of the moved DataList
+		 * @param   name - name of the new node, if empty the node will be nameless
+		 * @param   other - DataList to be nested, it is left empty
+		 * @note    Only available for DataLists with nodes of type NodeType::DataStore or NodeType::Any. If \p other is not owned by the library,
+		 *          for example because it was passed as an argument from LibraryLink, it is copied first.
+		 */
+		template<typename U>
+		void splice(std::string_view name, DataList<U>&& other);
+
+		/**
+		 * @brief   Get a copy of the value of the first node with given name.
+		 * @param   name - node name
+		 * @return  value of the node with containers deep-copied and owned by the library, or std::nullopt if there is no node with given name
+		 * @throws  ErrorName::DLInvalidNodeType - if node types were not validated and the node has value of different type than T
+		 * @note    Only the value of a single node is copied, which is much cheaper than cloning the whole DataList. The node itself remains in the list,
+		 *          because the DataStore API has no way of removing nodes.
+		 * @warning Containers in the returned value are independent of this DataList, but strings are returned as std::string_view into the node
+		 *          and are valid only as long as this DataList is alive.
+		 */
+		std::optional<value_type> extract(std::string_view name) const;
+
 		/**
 		 * @brief   Return a vector of DataList node values.
 		 * @return  a std::vector of node values
@@ -172,18 +314,45 @@ namespace LLU {
 		std::vector<DataNode<T>> toVector() const {
 			return {cbegin(), cend()};
 		}
+
+	private:
+		template<typename>
+		friend class DataList;
+
+		/// Get the index of nodes, building it on first use
+		DataStoreIndex& getIndex() const {
+			if (!nodeIndex) {
+				nodeIndex = std::make_unique<DataStoreIndex>(getContainer());
+			}
+			return *nodeIndex;
+		}
+
+		/// Get the value of a node which belongs to this DataList
+		value_type decode(DataStoreNode node) const {
+			GenericDataNode gn {node};
+			return typesValidated ? gn.asUnchecked<T>() : gn.as<T>();
+		}
+
+		/// Whether all nodes are known to have values of type T, in which case iterators decode nodes without checking their types
+		bool typesValidated = false;
+
+		/// Random-access index of nodes, created on the first positional or by-name lookup
+		mutable std::unique_ptr<DataStoreIndex> nodeIndex;
 	};
 
 	/* Definitions od DataList methods */
 
 	template<typename T>
-	DataList<T>::DataList(GenericDataList gds) : GenericDataList(std::move(gds)) {
+	DataList<T>::DataList(GenericDataList gds, DataListValidation validation)
+		: GenericDataList(std::move(gds)), typesValidated {validation != DataListValidation::OnAccess} {
 		if constexpr (!std::is_same_v<T, LLU::NodeType::Any>) {
-			std::for_each(GenericDataList::cbegin(), GenericDataList::cend(), [](auto node) {
-				if (node.type() != Argument::WrapperIndex<T>) {
-					ErrorManager::throwException(ErrorName::DLInvalidNodeType);
-				}
-			});
+			if (validation == DataListValidation::Eager) {
+				std::for_each(GenericDataList::cbegin(), GenericDataList::cend(), [](auto node) {
+					if (node.type() != Argument::WrapperIndex<T>) {
+						ErrorManager::throwException(ErrorName::DLInvalidNodeType);
+					}
+				});
+			}
 		}
 	}
 
@@ -201,21 +370,136 @@ namespace LLU {
 		}
 	}
 
+	template<typename T>
+	template<typename InputIt>
+	DataList<T> DataList<T>::fromRange(InputIt first, InputIt last) {
+		DataList result;
+		if constexpr (std::is_same_v<T, NodeType::Any>) {
+			for (; first != last; ++first) {
+				result.push_back(*first);
+			}
+		} else {
+			constexpr MArgumentType Type = Argument::WrapperIndex<T>;
+			auto add = Detail::dataStoreAdders<Type>(LibraryData::DataStoreAPI()).first;
+			DataStore ds = result.getContainer();
+			for (; first != last; ++first) {
+				value_type v = *first;
+				add(ds, Argument::toPrimitiveType<Type>(v));
+			}
+		}
+		return result;
+	}
+
+	template<typename T>
+	template<typename NameIt, typename ValueIt>
+	DataList<T> DataList<T>::fromNamedRange(NameIt firstName, NameIt lastName, ValueIt firstValue) {
+		DataList result;
+		if constexpr (std::is_same_v<T, NodeType::Any>) {
+			for (; firstName != lastName; ++firstName, ++firstValue) {
+				result.push_back(*firstName, *firstValue);
+			}
+		} else {
+			constexpr MArgumentType Type = Argument::WrapperIndex<T>;
+			auto addNamed = Detail::dataStoreAdders<Type>(LibraryData::DataStoreAPI()).second;
+			DataStore ds = result.getContainer();
+			// names do not have to be null-terminated, so each one is copied to a buffer which is reused for the whole range
+			std::string name;
+			for (; firstName != lastName; ++firstName, ++firstValue) {
+				name = std::string_view {*firstName};
+				value_type v = *firstValue;
+				addNamed(ds, name.data(), Argument::toPrimitiveType<Type>(v));
+			}
+		}
+		return result;
+	}
+
 	template<typename T>
 	DataList<T> DataList<T>::clone() const {
-		return DataList {cloneContainer(), Ownership::Library};
+		DataList result {cloneContainer(), Ownership::Library};
+		result.typesValidated = typesValidated;
+		return result;
 	}
 
 	template<typename T>
 	void DataList<T>::push_back(value_type nodeData) {
 		GenericDataList::push_back(std::move(nodeData));
+		if (nodeIndex) {
+			nodeIndex->append(back());
+		}
 	}
 
 	template<typename T>
 	void DataList<T>::push_back(std::string_view name, value_type nodeData) {
 		GenericDataList::push_back(name, std::move(nodeData));
+		if (nodeIndex) {
+			nodeIndex->append(back());
+		}
+	}
+
+	template<typename T>
+	void DataList<T>::append(DataList&& other) {
+		if (&other == this) {
+			return;
+		}
+		GenericDataList::append(std::move(other));
+		typesValidated = typesValidated && other.typesValidated;
+		nodeIndex.reset();
+		other.typesValidated = true;
+		other.nodeIndex.reset();
+	}
+
+	template<typename T>
+	template<typename U>
+	void DataList<T>::splice(std::string_view name, DataList<U>&& other) {
+		static_assert(std::is_same_v<T, NodeType::DataStore> || std::is_same_v<T, NodeType::Any>, "DataList nodes cannot hold nested DataLists.");
+		GenericDataList nested {std::move(other)};
+		if (nested.getOwner() != Ownership::Library) {
+			nested = nested.clone();
+		}
+		if (name.empty()) {
+			push_back(std::move(nested));
+		} else {
+			push_back(name, std::move(nested));
+		}
+		static_cast<GenericDataList&>(other) = GenericDataList {};
+		other.typesValidated = true;
+		other.nodeIndex.reset();
 	}
 
+	template<typename T>
+	auto DataList<T>::extract(std::string_view name) const -> std::optional<value_type> {
+		GenericDataNode node {getIndex().find(name)};
+		if (!node) {
+			return std::nullopt;
+		}
+		if constexpr (std::is_same_v<T, NodeType::Any>) {
+			return node.valueCopy();
+		} else {
+			if (!typesValidated && node.type() != Argument::WrapperIndex<T>) {
+				ErrorManager::throwException(ErrorName::DLInvalidNodeType);
+			}
+			return std::get<value_type>(node.valueCopy());
+		}
+	}
+
+
+	/**
+	 * @brief   Create DataList with a single node which holds all values from a range packed into a flat NumericArray.
+	 * @details Storing numbers in one NumericArray node instead of one node per number is much faster to build and to transfer, and the Wolfram Language
+	 *          side gets a packed array. Use it when the receiving code does not need separate nodes.
+	 * @tparam  InputIt - input iterator over values of one of the NumericArray element types
+	 * @param   first - iterator to the first value
+	 * @param   last - iterator past the last value
+	 * @param   name - name of the node
+	 * @return  new DataList with one NumericArray node
+	 */
+	template<typename InputIt>
+	DataList<NodeType::NumericArray> packedDataList(InputIt first, InputIt last, std::string_view name = "") {
+		using ElementType = typename std::iterator_traits<InputIt>::value_type;
+		DataList<NodeType::NumericArray> result;
+		result.push_back(name, NumericArray<ElementType>(first, last));
+		return result;
+	}
 
 	namespace Detail {
 		template<typename T, typename IteratorType>
@@ -0,0 +1,78 @@
+/**
+ * @file	DataListProfile.hpp
+ * @brief	Node counts and memory footprint of a DataList tree.
+ *
+ * Results returned as deeply nested DataLists are easy to build but it is hard to see how much kernel memory they hold. profileDataList walks
+ * a DataList recursively and counts nodes of every type, bytes of arrays and strings stored in the nodes and the depth of nesting, which helps
+ * to find result structures worth flattening, e.g. into a DataTable or PackedStrings. In the Wolfram Language, the same report is available
+ * for any Developer`DataStore via LLU`DataListProfile.
+ */
+#ifndef LLU_CONTAINERS_DATALISTPROFILE_HPP
+#define LLU_CONTAINERS_DATALISTPROFILE_HPP
+
+#include <array>
+#include <cstddef>
+
+#include "LLU/Containers/DataList.h"
+#include "LLU/MArgument.h"
+
+namespace LLU {
+
+	/**
+	 * @struct  DataListProfile
+	 * @brief   Summary of a DataList tree: node counts per MArgumentType, payload bytes and maximal depth
+	 *
+	 * Payload bytes are the sizes of data that nodes refer to: elements of Tensors, NumericArrays and Images, explicit values and indices of
+	 * SparseArrays and UTF-8 bytes of strings. Scalar nodes and nested DataLists themselves have no payload, and the fixed overhead of every
+	 * node and container is not included.
+	 */
+	struct DataListProfile {
+		/// Number of different MArgumentTypes, used as the size of per-type arrays
+		static constexpr std::size_t TypeCount = static_cast<std::size_t>(MArgumentType::DataStore) + 1;
+
+		/// Number of nodes of each type, indexed by MArgumentType
+		std::array<mint, TypeCount> nodeCounts {};
+
+		/// Payload bytes of nodes of each type, indexed by MArgumentType
+		std::array<mint, TypeCount> payloadBytes {};
+
+		/// Total length of node names in bytes
+		mint nameBytes = 0;
+
+		/// Depth of the deepest DataList in the tree, the profiled DataList itself has depth 1
+		mint maxDepth = 0;
+
+		/// Get the number of nodes of given type
+		[[nodiscard]] mint nodeCount(MArgumentType t) const noexcept {
+			return nodeCounts[static_cast<std::size_t>(t)];
+		}
+
+		/// Get the payload bytes of nodes of given type
+		[[nodiscard]] mint bytes(MArgumentType t) const noexcept {
+			return payloadBytes[static_cast<std::size_t>(t)];
+		}
+
+		/// Get the number of all nodes in the tree, including nested DataLists
+		[[nodiscard]] mint totalNodes() const noexcept;
+
+		/// Get the payload bytes of all nodes in the tree
+		[[nodiscard]] mint totalBytes() const noexcept;
+
+		/**
+		 * @brief   Store the profile in a DataList, which can be returned from a library function
+		 * @return  DataList with nodes "NodeCounts" and "PayloadBytes" (nested DataLists of integers named after node types), "NameBytes",
+		 *          "TotalNodes", "TotalBytes" and "MaxDepth"
+		 */
+		[[nodiscard]] DataList<NodeType::Any> toDataList() const;
+	};
+
+	/**
+	 * @brief   Walk a DataList recursively and collect node counts and payload bytes of all nodes
+	 * @param   list - DataList to profile, it is not modified and no node values are copied
+	 * @return  profile of the whole tree of nodes
+	 */
+	DataListProfile profileDataList(const GenericDataList& list);
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_DATALISTPROFILE_HPP
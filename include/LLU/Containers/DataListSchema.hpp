@@ -0,0 +1,369 @@
+/**
+ * @file	DataListSchema.hpp
+ * @brief	Conversion between C++ structs and DataLists based on a compile-time list of fields.
+ *
+ * To make a struct convertible, specialize DataListSchema for it with a static member \c fields, which is a tuple of schemaField descriptors:
+ * @code
+ *     struct Point { double x; double y; std::string label; };
+ *
+ *     template<>
+ *     struct LLU::DataListSchema<Point> {
+ *         static constexpr auto fields = std::make_tuple(LLU::schemaField("x", &Point::x), LLU::schemaField("y", &Point::y),
+ *                                                        LLU::schemaField("label", &Point::label));
+ *     };
+ * @endcode
+ * Point is then stored as <tt>Developer`DataStore["x" -> 1., "y" -> 2., "label" -> "A"]</tt>.
+ */
+#ifndef LLU_CONTAINERS_DATALISTSCHEMA_HPP
+#define LLU_CONTAINERS_DATALISTSCHEMA_HPP
+
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "LLU/Containers/DataList.h"
+#include "LLU/Containers/NumericArray.h"
+#include "LLU/Containers/Views/NumericArray.hpp"
+#include "LLU/ErrorLog/ErrorManager.h"
+#include "LLU/Utilities.hpp"
+
+namespace LLU {
+
+	/**
+	 * @brief   Description of a single field of a struct: name of the corresponding DataList node and a pointer to the data member
+	 * @tparam  Class - struct type
+	 * @tparam  Member - type of the data member
+	 */
+	template<typename Class, typename Member>
+	struct SchemaField {
+		/// Name of the DataList node, it must refer to a null-terminated string such as a string literal
+		std::string_view name;
+
+		/// Pointer to the data member
+		Member Class::*member;
+	};
+
+	/**
+	 * @brief   Create a descriptor of a struct field
+	 * @param   name - name of the DataList node, must be a null-terminated string such as a string literal
+	 * @param   member - pointer to the data member
+	 */
+	template<typename Class, typename Member>
+	constexpr SchemaField<Class, Member> schemaField(std::string_view name, Member Class::*member) {
+		return {name, member};
+	}
+
+	/**
+	 * @brief   Specialize this template for a struct to make it convertible to and from DataList.
+	 * @details The specialization must have a static member \c fields, which is a tuple of descriptors created with schemaField. Supported field types
+	 *          are bool, integral and floating-point types, std::complex<double>, std::string, std::vector of integral or floating-point types (stored
+	 *          as a NumericArray node), other structs with a DataListSchema and std::vector of such structs (stored as a DataList of DataLists).
+	 * @tparam  T - a struct type
+	 */
+	template<typename T>
+	struct DataListSchema {
+		//	static constexpr auto fields = std::make_tuple(LLU::schemaField("name", &T::member), ...);
+	};
+
+	/// @cond
+	namespace Detail {
+		template<typename T, typename = void>
+		inline constexpr bool hasDataListSchema = false;
+
+		template<typename T>
+		inline constexpr bool hasDataListSchema<T, std::void_t<decltype(DataListSchema<T>::fields)>> = true;
+
+		template<typename T>
+		inline constexpr bool isNumericVector = false;
+
+		template<typename T, typename A>
+		inline constexpr bool isNumericVector<std::vector<T, A>> = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+		template<typename T>
+		inline constexpr bool isSchemaVector = false;
+
+		template<typename T, typename A>
+		inline constexpr bool isSchemaVector<std::vector<T, A>> = hasDataListSchema<T>;
+	}  // namespace Detail
+	/// @endcond
+
+	/**
+	 * @brief   Store a struct with a DataListSchema in a new DataList, with one named node per field
+	 * @param   value - a struct
+	 * @return  new DataList owned by the library
+	 */
+	template<typename T>
+	GenericDataList toDataList(const T& value);
+
+	/**
+	 * @class   DataListDecoder
+	 * @brief   Decoder of DataLists into structs with a DataListSchema.
+	 * @details Positions of fields found by matching node names against field names are remembered. Following DataLists of the same length only
+	 *          have their node names compared with field names at the remembered positions, without searching, and names are matched again if any
+	 *          of them differs. If the nodes are in the same order as the fields, they are decoded during a single walk over the DataList.
+	 *          Decoders of nested structs are kept in the decoder of the outer struct, so a std::vector of structs has its names matched only once.
+	 * @tparam  T - a struct with a DataListSchema
+	 */
+	template<typename T>
+	class DataListDecoder {
+		static_assert(Detail::hasDataListSchema<T>, "DataListDecoder requires a specialization of DataListSchema for the decoded type.");
+
+		static constexpr auto& fields = DataListSchema<T>::fields;
+		static constexpr std::size_t fieldCount = std::tuple_size_v<remove_cv_ref<decltype(fields)>>;
+
+		/// Decoder needed for a field of type Member, it is an empty tuple unless Member is a struct with a schema or a vector of such structs
+		template<typename Member>
+		static auto nestedDecoderFor() {
+			if constexpr (Detail::hasDataListSchema<Member>) {
+				return DataListDecoder<Member> {};
+			} else if constexpr (Detail::isSchemaVector<Member>) {
+				return DataListDecoder<typename Member::value_type> {};
+			} else {
+				return std::tuple<> {};
+			}
+		}
+
+		template<typename Field>
+		using NestedDecoder = decltype(nestedDecoderFor<remove_cv_ref<decltype(std::declval<T&>().*(std::declval<Field>().member))>>());
+
+		template<typename Tuple>
+		struct NestedDecoders;
+
+		template<typename... Fields>
+		struct NestedDecoders<std::tuple<Fields...>> {
+			using type = std::tuple<NestedDecoder<Fields>...>;
+		};
+
+	public:
+		/**
+		 * @brief   Decode a DataList into a struct
+		 * @param   list - a DataList with at least one node for each field of T, additional nodes are ignored
+		 * @return  new struct with values taken from the DataList
+		 * @throws  ErrorName::DLMissingNode - if there is no node with the name of one of the fields
+		 * @throws  ErrorName::DLInvalidNodeType - if a node has different type than the corresponding field
+		 */
+		T decode(const GenericDataList& list);
+
+		/// Forget the positions of fields, so that names are matched again for the next decoded DataList
+		void reset() noexcept {
+			layoutLength.reset();
+		}
+
+	private:
+		/// Match node names against field names and remember the position of each field
+		void resolve(const GenericDataList& list);
+
+		/// Check if \p list has the same length as the last resolved DataList and field names at the remembered positions
+		bool layoutMatches(const GenericDataList& list);
+
+		/// Get names of all fields, in the order of fields
+		static std::array<std::string_view, fieldCount> fieldNames() {
+			return std::apply([](const auto&... field) { return std::array<std::string_view, fieldCount> {field.name...}; }, fields);
+		}
+
+		/// Decode a single field of \p result from \p node
+		template<std::size_t I>
+		void decodeField(T& result, GenericDataNode node);
+
+		/// Decode all fields from consecutive nodes, starting at \p node
+		template<std::size_t... Is>
+		void decodeInOrder(T& result, GenericDataNode node, std::index_sequence<Is...> /*unused*/);
+
+		/// Decode all fields from nodes at the remembered positions
+		template<std::size_t... Is>
+		void decodeByPosition(T& result, std::index_sequence<Is...> /*unused*/);
+
+		/// Store handles of all nodes of \p list
+		void collectNodes(const GenericDataList& list);
+
+		/// Number of nodes in the DataLists for which positions were resolved
+		std::optional<mint> layoutLength;
+
+		/// Whether nodes are in the same order as the fields
+		bool inOrder = false;
+
+		/// Position of the node for each field
+		std::array<std::size_t, fieldCount> positions {};
+
+		/// Handles of nodes of the currently decoded DataList, reused between calls
+		std::vector<DataStoreNode> nodes;
+
+		/// Decoders of nested structs, one per field
+		typename NestedDecoders<remove_cv_ref<decltype(fields)>>::type nested;
+	};
+
+	/**
+	 * @brief   Decode a DataList into a struct with a DataListSchema
+	 * @param   list - a DataList with at least one node for each field of T
+	 * @return  new struct with values taken from the DataList
+	 * @note    To decode many DataLists with the same layout, reuse a DataListDecoder<T> to match names only once.
+	 */
+	template<typename T>
+	T fromDataList(const GenericDataList& list) {
+		return DataListDecoder<T> {}.decode(list);
+	}
+
+	/// @cond
+	namespace Detail {
+		template<typename Member>
+		void encodeField(GenericDataList& list, std::string_view name, const Member& value) {
+			if constexpr (std::is_same_v<Member, bool> || std::is_same_v<Member, std::complex<double>>) {
+				list.push_back(name, value);
+			} else if constexpr (std::is_integral_v<Member>) {
+				list.push_back(name, static_cast<mint>(value));
+			} else if constexpr (std::is_floating_point_v<Member>) {
+				list.push_back(name, static_cast<double>(value));
+			} else if constexpr (std::is_same_v<Member, std::string>) {
+				list.push_back(name, std::string_view {value});
+			} else if constexpr (isNumericVector<Member>) {
+				list.push_back(name, GenericNumericArray {NumericArray<typename Member::value_type>(value.begin(), value.end())});
+			} else if constexpr (hasDataListSchema<Member>) {
+				list.push_back(name, toDataList(value));
+			} else if constexpr (isSchemaVector<Member>) {
+				GenericDataList elements;
+				for (const auto& elem : value) {
+					elements.push_back(toDataList(elem));
+				}
+				list.push_back(name, std::move(elements));
+			} else {
+				static_assert(dependent_false_v<Member>, "Unsupported type of a field in DataListSchema.");
+			}
+		}
+	}  // namespace Detail
+	/// @endcond
+
+	template<typename T>
+	GenericDataList toDataList(const T& value) {
+		static_assert(Detail::hasDataListSchema<T>, "toDataList requires a specialization of DataListSchema for the encoded type.");
+		GenericDataList res;
+		std::apply([&](const auto&... field) { (Detail::encodeField(res, field.name, value.*(field.member)), ...); }, DataListSchema<T>::fields);
+		return res;
+	}
+
+	template<typename T>
+	void DataListDecoder<T>::collectNodes(const GenericDataList& list) {
+		nodes.clear();
+		for (auto node : list) {
+			nodes.push_back(node.node);
+		}
+	}
+
+	template<typename T>
+	void DataListDecoder<T>::resolve(const GenericDataList& list) {
+		// the remembered layout is replaced only if all fields are found, so that the decoder can be reused after DLMissingNode
+		layoutLength.reset();
+		collectNodes(list);
+		const auto names = fieldNames();
+		std::array<std::size_t, fieldCount> found {};
+		bool ordered = true;
+		for (std::size_t i = 0; i < fieldCount; ++i) {
+			// nodes in the same order as fields are the common case, so the node at the position of the field is checked first
+			if (i < nodes.size() && GenericDataNode {nodes[i]}.name() == names[i]) {
+				found[i] = i;
+				continue;
+			}
+			ordered = false;
+			std::size_t pos = 0;
+			while (pos < nodes.size() && GenericDataNode {nodes[pos]}.name() != names[i]) {
+				++pos;
+			}
+			if (pos == nodes.size()) {
+				ErrorManager::throwException(ErrorName::DLMissingNode, std::string {names[i]});
+			}
+			found[i] = pos;
+		}
+		positions = found;
+		inOrder = ordered;
+		layoutLength = list.length();
+	}
+
+	template<typename T>
+	bool DataListDecoder<T>::layoutMatches(const GenericDataList& list) {
+		if (layoutLength != list.length()) {
+			return false;
+		}
+		const auto names = fieldNames();
+		if (inOrder) {
+			GenericDataNode node {list.front()};
+			for (std::size_t i = 0; i < fieldCount; ++i, node = node.next()) {
+				if (node.name() != names[i]) {
+					return false;
+				}
+			}
+			return true;
+		}
+		collectNodes(list);
+		for (std::size_t i = 0; i < fieldCount; ++i) {
+			if (GenericDataNode {nodes[positions[i]]}.name() != names[i]) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template<typename T>
+	template<std::size_t I>
+	void DataListDecoder<T>::decodeField(T& result, GenericDataNode node) {
+		auto& value = result.*(std::get<I>(fields).member);
+		using Member = remove_cv_ref<decltype(value)>;
+		if constexpr (std::is_same_v<Member, bool> || std::is_same_v<Member, std::complex<double>>) {
+			value = node.as<Member>();
+		} else if constexpr (std::is_integral_v<Member>) {
+			value = static_cast<Member>(node.as<mint>());
+		} else if constexpr (std::is_floating_point_v<Member>) {
+			value = static_cast<Member>(node.as<double>());
+		} else if constexpr (std::is_same_v<Member, std::string>) {
+			value = node.as<std::string_view>();
+		} else if constexpr (Detail::isNumericVector<Member>) {
+			NumericArrayTypedView<typename Member::value_type> view {node.as<GenericNumericArray>()};
+			value.assign(view.begin(), view.end());
+		} else if constexpr (Detail::hasDataListSchema<Member>) {
+			value = std::get<I>(nested).decode(node.as<GenericDataList>());
+		} else if constexpr (Detail::isSchemaVector<Member>) {
+			auto elements = node.as<GenericDataList>();
+			value.clear();
+			value.reserve(static_cast<std::size_t>(elements.length()));
+			for (auto elem : elements) {
+				value.push_back(std::get<I>(nested).decode(elem.as<GenericDataList>()));
+			}
+		} else {
+			static_assert(dependent_false_v<Member>, "Unsupported type of a field in DataListSchema.");
+		}
+	}
+
+	template<typename T>
+	template<std::size_t... Is>
+	void DataListDecoder<T>::decodeInOrder(T& result, GenericDataNode node, std::index_sequence<Is...> /*unused*/) {
+		((decodeField<Is>(result, node), node = node.next()), ...);
+	}
+
+	template<typename T>
+	template<std::size_t... Is>
+	void DataListDecoder<T>::decodeByPosition(T& result, std::index_sequence<Is...> /*unused*/) {
+		(decodeField<Is>(result, GenericDataNode {nodes[positions[Is]]}), ...);
+	}
+
+	template<typename T>
+	T DataListDecoder<T>::decode(const GenericDataList& list) {
+		if (!layoutMatches(list)) {
+			resolve(list);
+		}
+		T result {};
+		if (inOrder) {
+			decodeInOrder(result, GenericDataNode {list.front()}, std::make_index_sequence<fieldCount> {});
+		} else {
+			decodeByPosition(result, std::make_index_sequence<fieldCount> {});
+		}
+		return result;
+	}
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_DATALISTSCHEMA_HPP
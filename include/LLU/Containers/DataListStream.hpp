@@ -0,0 +1,223 @@
+/**
+ * @file	DataListStream.hpp
+ * @brief	Streaming of DataList nodes to the Wolfram Language in chunks, via LibraryLink asynchronous task events.
+ *
+ * A library function that produces a lot of nodes normally builds the whole DataList in memory and returns it at the end. With DataListStream
+ * the nodes are produced on a background thread of an asynchronous task and every time the configured number of nodes is collected, they are sent
+ * to the Kernel as a single DataStore in a "DataListChunk" event, so only one chunk is kept in memory at a time:
+ * @code
+ * 	LLU_LIBRARY_FUNCTION(StreamSquares) {
+ * 		auto n = mngr.getInteger<mint>(0);
+ * 		mngr.set(LLU::startDataListStream<mint>(mngr.getInteger<mint>(1), [n](LLU::DataListStream<mint>& stream) {
+ * 			for (mint i = 0; i < n && stream.alive(); ++i) {
+ * 				stream.push_back(i * i);
+ * 			}
+ * 		}));
+ * 	}
+ * @endcode
+ * In the Wolfram Language, LLU`CollectDataListStream starts such function, passes chunks to an optional handler as they arrive and joins them into
+ * one Developer`DataStore.
+ */
+#ifndef LLU_CONTAINERS_DATALISTSTREAM_HPP
+#define LLU_CONTAINERS_DATALISTSTREAM_HPP
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "LLU/Containers/DataList.h"
+#include "LLU/ErrorLog/ErrorManager.h"
+#include "LLU/LibraryData.h"
+
+namespace LLU {
+
+	/**
+	 * @class   DataListStream
+	 * @brief   Collects DataList nodes and sends them to the Kernel in chunks of fixed size, as events of a LibraryLink asynchronous task.
+	 * @tparam  T - type of DataList nodes, any type from LLU::NodeType namespace
+	 *
+	 * Every chunk is sent in a "DataListChunk" event, finish() sends the remaining nodes and a "DataListFinished" event and fail() sends
+	 * a "DataListFailure" event with the name of an error. DataListStream is meant to be used on the thread of an asynchronous task,
+	 * usually it is created by startDataListStream.
+	 */
+	template<typename T>
+	class DataListStream {
+	public:
+		/// Type of values of DataList nodes
+		using value_type = typename DataList<T>::value_type;
+
+		/// Type of the event with a chunk of nodes
+		static constexpr const char* ChunkEvent = "DataListChunk";
+
+		/// Type of the event that marks the end of the stream
+		static constexpr const char* FinishedEvent = "DataListFinished";
+
+		/// Type of the event that reports an error of the producer
+		static constexpr const char* FailureEvent = "DataListFailure";
+
+		/**
+		 * @brief   Create a stream of nodes for an asynchronous task
+		 * @param   taskId - id of the asynchronous task whose events carry the chunks
+		 * @param   chunkSize - number of nodes in a chunk, values smaller than 1 are treated as 1
+		 */
+		DataListStream(mint taskId, mint chunkSize) : task {taskId}, chunk {std::max(chunkSize, mint {1})} {}
+
+		/**
+		 * @brief   Add a node to the current chunk and send the chunk if it is full
+		 * @param   nodeData - value of the new node
+		 */
+		void push_back(value_type nodeData) {
+			pending.push_back(std::move(nodeData));
+			flushIfFull();
+		}
+
+		/**
+		 * @brief   Add a named node to the current chunk and send the chunk if it is full
+		 * @param   name - name of the new node
+		 * @param   nodeData - value of the new node
+		 */
+		void push_back(std::string_view name, value_type nodeData) {
+			pending.push_back(name, std::move(nodeData));
+			flushIfFull();
+		}
+
+		/**
+		 * @brief   Send the nodes collected so far as a chunk, even if there are fewer of them than the chunk size
+		 * @note    If the task has been removed by the Kernel, the nodes are discarded and alive() returns false from now on.
+		 */
+		void flush();
+
+		/**
+		 * @brief   Send the remaining nodes and the "DataListFinished" event with the number of chunks and nodes sent
+		 */
+		void finish();
+
+		/**
+		 * @brief   Send the "DataListFailure" event with the name of an error, the nodes collected since the last chunk are discarded
+		 * @param   errorName - name of the error, for example LibraryLinkError::name()
+		 */
+		void fail(const std::string& errorName);
+
+		/**
+		 * @brief   Check if the Kernel still waits for the nodes, producers should stop early when it does not
+		 * @return  false iff the asynchronous task has been removed
+		 */
+		[[nodiscard]] bool alive() const {
+			return !stopped && LibraryData::DataStoreAPI()->asynchronousTaskAliveQ(task) != 0;
+		}
+
+		/// Get the number of nodes in a chunk
+		[[nodiscard]] mint chunkSize() const noexcept {
+			return chunk;
+		}
+
+		/// Get the number of chunks sent so far
+		[[nodiscard]] mint chunkCount() const noexcept {
+			return chunks;
+		}
+
+		/// Get the number of nodes sent so far
+		[[nodiscard]] mint nodeCount() const noexcept {
+			return nodes;
+		}
+
+	private:
+		void flushIfFull() {
+			if (pending.length() >= chunk) {
+				flush();
+			}
+		}
+
+		/// Raise an event of the task, the DataStore is passed to the Kernel which takes ownership of it
+		void send(const char* eventType, const GenericDataList& data) const {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast): required by LibraryLink API
+			LibraryData::DataStoreAPI()->raiseAsyncEvent(task, const_cast<char*>(eventType), data.abandonContainer());
+		}
+
+		mint task;
+		mint chunk;
+		mint chunks = 0;
+		mint nodes = 0;
+		bool stopped = false;
+		DataList<T> pending;
+	};
+
+	template<typename T>
+	void DataListStream<T>::flush() {
+		if (pending.length() == 0) {
+			return;
+		}
+		if (!alive()) {
+			stopped = true;
+			pending = DataList<T> {};
+			return;
+		}
+		nodes += pending.length();
+		++chunks;
+		send(ChunkEvent, pending);
+		pending = DataList<T> {};
+	}
+
+	template<typename T>
+	void DataListStream<T>::finish() {
+		flush();
+		if (stopped) {
+			return;
+		}
+		DataList<mint> summary;
+		summary.push_back("Chunks", chunks);
+		summary.push_back("Nodes", nodes);
+		send(FinishedEvent, summary);
+		stopped = true;
+	}
+
+	template<typename T>
+	void DataListStream<T>::fail(const std::string& errorName) {
+		pending = DataList<T> {};
+		if (!alive()) {
+			return;
+		}
+		DataList<std::string_view> error;
+		error.push_back("Error", errorName);
+		send(FailureEvent, error);
+		stopped = true;
+	}
+
+	/**
+	 * @brief   Start an asynchronous task with a background thread that produces DataList nodes and streams them to the Kernel in chunks
+	 * @tparam  T - type of DataList nodes, any type from LLU::NodeType namespace
+	 * @param   chunkSize - number of nodes in a chunk
+	 * @param   producer - callable taking DataListStream<T>&, it is called on the task thread, so it must not use the MArgumentManager
+	 *          of the library function that started the task, and it should return early when DataListStream::alive() is false
+	 * @return  id of the asynchronous task, which should be returned from the library function that called startDataListStream
+	 * @note    When the producer returns, the stream is finished. If it throws, the error name is sent to the Kernel in a "DataListFailure" event,
+	 *          so the producer should throw errors without message parameters, which are sent over WSTP that cannot be used from the task thread.
+	 */
+	template<typename T, typename F>
+	mint startDataListStream(mint chunkSize, F producer) {
+		struct StreamTask {
+			mint chunkSize;
+			F producer;
+		};
+		auto task = std::make_unique<StreamTask>(StreamTask {chunkSize, std::move(producer)});
+		auto run = [](mint taskId, void* data) {
+			std::unique_ptr<StreamTask> self {static_cast<StreamTask*>(data)};
+			DataListStream<T> stream {taskId, self->chunkSize};
+			try {
+				self->producer(stream);
+				stream.finish();
+			} catch (const LibraryLinkError& e) {
+				stream.fail(e.name());
+			} catch (...) {
+				stream.fail(ErrorName::FunctionError);
+			}
+		};
+		// from now on the task data is owned by the task thread
+		return LibraryData::DataStoreAPI()->createAsynchronousTaskWithThread(run, task.release());
+	}
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_DATALISTSTREAM_HPP
@@ -0,0 +1,281 @@
+/**
+ * @file	DataTable.hpp
+ * @brief	Columnar tables passed between C++ and the Wolfram Language as a DataList with one node per column.
+ *
+ * A table with N rows and K columns stored as a DataList of rows takes N*K DataStore nodes, and building or reading them dominates the cost of
+ * returning query results. A DataTable takes exactly K named nodes instead: numeric columns are flat NumericArrays and text columns are
+ * nested DataLists with all UTF-8 bytes in one NumericArray and row offsets in another, as produced by PackedStrings:
+ * @code
+ *     Developer`DataStore["id" -> NumericArray[{1, 2}, "Integer64"],
+ *                         "name" -> Developer`DataStore["Values" -> NumericArray[{97, 98, 99}, "UnsignedInteger8"],
+ *                                                       "Offsets" -> NumericArray[{0, 1, 3}, "Integer64"]]]
+ * @endcode
+ * In the Wolfram Language, such table can be turned into a list of Associations with LLU`DataTableRows, or it is converted automatically
+ * when the library function is loaded with the "DataTable" return type.
+ */
+#ifndef LLU_CONTAINERS_DATATABLE_HPP
+#define LLU_CONTAINERS_DATATABLE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "LLU/Containers/DataList.h"
+#include "LLU/Containers/NumericArray.h"
+#include "LLU/Containers/PackedStrings.hpp"
+#include "LLU/Containers/Views/NumericArray.hpp"
+#include "LLU/ErrorLog/ErrorManager.h"
+
+namespace LLU {
+
+	/**
+	 * @brief   Type of a single cell of a DataTable column with elements of type T
+	 * @tparam  T - std::string for text columns or one of the NumericArray element types
+	 */
+	template<typename T>
+	using DataTableCell = std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+
+	/// @cond
+	namespace Detail {
+		/// Growing storage of a single numeric column of a DataTableBuilder
+		template<typename T>
+		struct TableColumnBuffer {
+			std::vector<T> values;
+
+			void reserve(std::size_t rows) {
+				values.reserve(rows);
+			}
+
+			void add(T v) {
+				values.push_back(v);
+			}
+
+			void moveTo(DataList<NodeType::Any>& table, std::string_view name) {
+				table.push_back(name, GenericNumericArray {NumericArray<T>(values.begin(), values.end())});
+				values = {};
+			}
+		};
+
+		/// Growing storage of a single text column of a DataTableBuilder, all strings are concatenated into one buffer
+		template<>
+		struct TableColumnBuffer<std::string> {
+			std::vector<std::uint8_t> bytes;
+			std::vector<mint> offsets {0};
+
+			void reserve(std::size_t rows) {
+				offsets.reserve(rows + 1);
+			}
+
+			void add(std::string_view s) {
+				bytes.insert(bytes.end(), s.begin(), s.end());
+				offsets.push_back(static_cast<mint>(bytes.size()));
+			}
+
+			void moveTo(DataList<NodeType::Any>& table, std::string_view name) {
+				PackedStrings packed {NumericArray<std::uint8_t>(bytes.begin(), bytes.end()), NumericArray<mint>(offsets.begin(), offsets.end())};
+				table.splice(name, std::move(packed).toDataList());
+				bytes = {};
+				offsets = {0};
+			}
+		};
+
+		/// Read-only access to a single numeric column of a DataTableReader
+		template<typename T>
+		struct TableColumnView {
+			NumericArrayTypedView<T> values;
+
+			explicit TableColumnView(GenericDataNode node) : values {node.as<GenericNumericArray>()} {
+				if (values.getRank() != 1) {
+					ErrorManager::throwExceptionWithDebugInfo(ErrorName::DimensionsError, "DataTable columns must be flat");
+				}
+			}
+
+			[[nodiscard]] mint size() const noexcept {
+				return values.size();
+			}
+
+			T operator[](mint row) const noexcept {
+				return values[row];
+			}
+		};
+
+		/// Read-only access to a single text column of a DataTableReader
+		template<>
+		struct TableColumnView<std::string> {
+			PackedStrings strings;
+
+			explicit TableColumnView(GenericDataNode node) : strings {DataList<NodeType::NumericArray>(node.as<GenericDataList>())} {}
+
+			[[nodiscard]] mint size() const noexcept {
+				return strings.size();
+			}
+
+			std::string_view operator[](mint row) const noexcept {
+				return strings[row];
+			}
+		};
+	}  // namespace Detail
+	/// @endcond
+
+	/**
+	 * @class   DataTableBuilder
+	 * @brief   Row-wise builder of a columnar table that is returned to the Wolfram Language as a DataList with one node per column.
+	 * @tparam  Columns - types of columns, std::string for text or any NumericArray element type (e.g. mint, double, std::uint8_t)
+	 *
+	 * Example:
+	 * @code
+	 *     LLU::DataTableBuilder<mint, double, std::string> table {{"id", "score", "name"}};
+	 *     table.addRow(1, 0.5, "first");
+	 *     table.addRow(2, 0.25, "second");
+	 *     mngr.set(std::move(table).toDataList());
+	 * @endcode
+	 */
+	template<typename... Columns>
+	class DataTableBuilder {
+	public:
+		/// Number of columns
+		static constexpr std::size_t ColumnCount = sizeof...(Columns);
+
+		/**
+		 * @brief   Create an empty table with given column names
+		 * @param   columnNames - names of columns, in the same order as Columns
+		 * @param   expectedRows - number of rows to reserve memory for
+		 */
+		explicit DataTableBuilder(std::array<std::string, ColumnCount> columnNames, mint expectedRows = 0) : names {std::move(columnNames)} {
+			std::apply([expectedRows](auto&... column) { (column.reserve(static_cast<std::size_t>(expectedRows)), ...); }, columns);
+		}
+
+		/**
+		 * @brief   Append a row to the table
+		 * @param   cells - values of all columns in the new row, strings are copied to the table
+		 */
+		void addRow(DataTableCell<Columns>... cells) {
+			addRow(std::index_sequence_for<Columns...> {}, cells...);
+			++rows;
+		}
+
+		/// Get the number of rows added so far
+		[[nodiscard]] mint rowCount() const noexcept {
+			return rows;
+		}
+
+		/**
+		 * @brief   Move all columns into a DataList with one named node per column, which can be returned from a library function
+		 * @return  DataList with a NumericArray node for every numeric column and a nested DataList of bytes and offsets for every text column
+		 */
+		DataList<NodeType::Any> toDataList() && {
+			DataList<NodeType::Any> table;
+			moveColumns(table, std::index_sequence_for<Columns...> {});
+			rows = 0;
+			return table;
+		}
+
+	private:
+		template<std::size_t... Is>
+		void addRow(std::index_sequence<Is...> /*unused*/, DataTableCell<Columns>... cells) {
+			(std::get<Is>(columns).add(cells), ...);
+		}
+
+		template<std::size_t... Is>
+		void moveColumns(DataList<NodeType::Any>& table, std::index_sequence<Is...> /*unused*/) {
+			(std::get<Is>(columns).moveTo(table, names[Is]), ...);
+		}
+
+		std::array<std::string, ColumnCount> names;
+		std::tuple<Detail::TableColumnBuffer<Columns>...> columns;
+		mint rows = 0;
+	};
+
+	/**
+	 * @class   DataTableReader
+	 * @brief   Row-wise reader of a columnar table received from the Wolfram Language or created with DataTableBuilder.
+	 * @tparam  Columns - types of columns to read, std::string for text or any NumericArray element type
+	 * @note    Cells are read directly from the arrays stored in the DataList, so the reader must not outlive it.
+	 */
+	template<typename... Columns>
+	class DataTableReader {
+	public:
+		/// Number of columns
+		static constexpr std::size_t ColumnCount = sizeof...(Columns);
+
+		/// Type of a single row
+		using row_type = std::tuple<DataTableCell<Columns>...>;
+
+		/**
+		 * @brief   Find columns with given names in a DataList
+		 * @param   table - DataList with one node per column, other nodes are ignored
+		 * @param   columnNames - names of columns to read, in the same order as Columns
+		 * @throws  ErrorName::DLMissingNode - if there is no node with one of the column names
+		 * @throws  ErrorName::NumericArrayTypeError - if a numeric column has different element type than requested
+		 * @throws  ErrorName::DimensionsError - if columns are not flat or have different lengths
+		 */
+		DataTableReader(const GenericDataList& table, const std::array<std::string_view, ColumnCount>& columnNames)
+			: DataTableReader(DataStoreIndex {table.getContainer()}, columnNames, std::index_sequence_for<Columns...> {}) {}
+
+		/// Get the number of rows
+		[[nodiscard]] mint rowCount() const noexcept {
+			return rows;
+		}
+
+		/**
+		 * @brief   Get a cell of the table
+		 * @tparam  I - index of the column
+		 * @param   row - index of the row, must be smaller than rowCount()
+		 */
+		template<std::size_t I>
+		auto get(mint row) const noexcept {
+			return std::get<I>(columns)[row];
+		}
+
+		/**
+		 * @brief   Get all cells in a row
+		 * @param   row - index of the row, must be smaller than rowCount()
+		 */
+		row_type row(mint row) const noexcept {
+			return std::apply([row](const auto&... column) { return row_type {column[row]...}; }, columns);
+		}
+
+		/**
+		 * @brief   Call a function on every row of the table, in order
+		 * @param   f - callable taking one argument per column, of type DataTableCell<Column>
+		 */
+		template<typename F>
+		void forEachRow(F&& f) const {
+			for (mint r = 0; r < rows; ++r) {
+				std::apply([&f, r](const auto&... column) { f(column[r]...); }, columns);
+			}
+		}
+
+	private:
+		template<std::size_t... Is>
+		DataTableReader(DataStoreIndex index, const std::array<std::string_view, ColumnCount>& columnNames, std::index_sequence<Is...> /*unused*/)
+			: columns {Detail::TableColumnView<Columns> {findColumn(index, columnNames[Is])}...} {
+			if constexpr (ColumnCount > 0) {
+				rows = std::get<0>(columns).size();
+				if (((std::get<Is>(columns).size() != rows) || ...)) {
+					ErrorManager::throwExceptionWithDebugInfo(ErrorName::DimensionsError, "DataTable columns must have equal lengths");
+				}
+			}
+		}
+
+		static GenericDataNode findColumn(DataStoreIndex& index, std::string_view name) {
+			GenericDataNode node {index.find(name)};
+			if (!node) {
+				ErrorManager::throwException(ErrorName::DLMissingNode, std::string {name});
+			}
+			return node;
+		}
+
+		std::tuple<Detail::TableColumnView<Columns>...> columns;
+		mint rows = 0;
+	};
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_DATATABLE_HPP
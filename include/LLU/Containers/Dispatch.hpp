@@ -0,0 +1,78 @@
+/**
+ * @file	Dispatch.hpp
+ * @brief	Uniform interface for calling generic functions on containers of data type known only at runtime.
+ *
+ * All functions in this file take a TypeList of data types that the callback must handle. The callback is instantiated only for those types
+ * (intersected with the types supported by given container), so restricting the list, e.g. to FloatingTypes, saves compile time and binary size.
+ * A container of a type outside of the list causes the type error appropriate for given container to be thrown.
+ */
+#ifndef LLU_CONTAINERS_DISPATCH_HPP
+#define LLU_CONTAINERS_DISPATCH_HPP
+
+#include <utility>
+
+#include "LLU/Containers/Views/Image.hpp"
+#include "LLU/Containers/Views/NumericArray.hpp"
+#include "LLU/Containers/Views/Tensor.hpp"
+#include "LLU/TypeDispatch.hpp"
+
+namespace LLU {
+
+	/**
+	 * @brief   Call \p f with a NumericArrayTypedView over \p na
+	 * @tparam  Types - TypeList of data types for which \p f is instantiated
+	 * @param   na - NumericArray of any type
+	 * @param   f - callable object that accepts NumericArrayTypedView<T> for every T in \p Types supported by NumericArray
+	 * @return  result of calling \p f
+	 * @throws  ErrorName::NumericArrayTypeError - if the type of \p na is not in \p Types
+	 */
+	template<typename Types = AllTypes, typename F>
+	auto dispatch(const NumericArrayView& na, F&& f) {
+		return asTypedNumericArray<Types>(na, std::forward<F>(f));
+	}
+
+	/**
+	 * @brief   Call \p f with a TensorTypedView over \p t
+	 * @tparam  Types - TypeList of data types for which \p f is instantiated
+	 * @param   t - Tensor of any type
+	 * @param   f - callable object that accepts TensorTypedView<T> for every T in \p Types supported by Tensor
+	 * @return  result of calling \p f
+	 * @throws  ErrorName::TensorTypeError - if the type of \p t is not in \p Types
+	 */
+	template<typename Types = AllTypes, typename F>
+	auto dispatch(const TensorView& t, F&& f) {
+		return asTypedTensor<Types>(t, std::forward<F>(f));
+	}
+
+	/**
+	 * @brief   Call \p f with an ImageTypedView over \p im
+	 * @tparam  Types - TypeList of data types for which \p f is instantiated
+	 * @param   im - Image of any type
+	 * @param   f - callable object that accepts ImageTypedView<T> for every T in \p Types supported by Image
+	 * @return  result of calling \p f
+	 * @throws  ErrorName::ImageTypeError - if the type of \p im is not in \p Types
+	 */
+	template<typename Types = AllTypes, typename F>
+	auto dispatch(const ImageView& im, F&& f) {
+		return asTypedImage<Types>(im, std::forward<F>(f));
+	}
+
+	/**
+	 * @brief   Call \p f with typed views over two containers, for example to implement a binary operation on NumericArrays of any types
+	 * @tparam  TypesA - TypeList of data types accepted for the first container
+	 * @tparam  TypesB - TypeList of data types accepted for the second container, by default the same as \p TypesA
+	 * @param   a - first container (NumericArray, Tensor or Image, generic or view)
+	 * @param   b - second container (NumericArray, Tensor or Image, generic or view)
+	 * @param   f - callable object that accepts a pair of typed views, it is instantiated for every combination of types
+	 * @return  result of calling \p f
+	 * @throws  type error of the container whose type is not in the corresponding list
+	 * @note    Number of instantiations of \p f is the product of lengths of both lists, so it is worth restricting them.
+	 */
+	template<typename TypesA = AllTypes, typename TypesB = TypesA, typename A, typename B, typename F>
+	auto dispatch(const A& a, const B& b, F&& f) {
+		return dispatch<TypesA>(a, [&b, &f](auto viewA) { return dispatch<TypesB>(b, [&viewA, &f](auto viewB) { return f(viewA, viewB); }); });
+	}
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_DISPATCH_HPP
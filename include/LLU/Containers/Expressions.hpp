@@ -0,0 +1,390 @@
+/**
+ * @file	Expressions.hpp
+ * @brief	Lazy elementwise arithmetic on NumericArrays, Tensors and other containers with contiguous data.
+ *
+ * Arithmetic operators applied to containers derived from IterableContainer (NumericArray, Tensor, Image, AlignedBuffer, etc.) do not compute
+ * anything, they build a lightweight expression object which remembers the operands. The whole expression is evaluated element by element in
+ * a single loop only when it is assigned to a destination container, so no temporary containers are created and the memory is traversed once.
+ * The loop body is a plain function of the element index, which compilers can inline and vectorize.
+ *
+ * @code
+ * 	LLU_LIBRARY_FUNCTION(Axpy) {
+ * 		auto x = mngr.getNumericArray<double>(0);
+ * 		auto y = mngr.getNumericArray<double>(1);
+ * 		auto res = LLU::Expr::materialize<LLU::NumericArray<double>>(x * 2.0 + y);
+ * 		mngr.set(res);
+ * 	}
+ * @endcode
+ *
+ * Operands must stay alive and unchanged until the expression is evaluated. Expressions may refer to the destination container, because
+ * every element of the result depends only on the elements of the operands at the same position.
+ */
+#ifndef LLU_CONTAINERS_EXPRESSIONS_HPP
+#define LLU_CONTAINERS_EXPRESSIONS_HPP
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "LLU/Async/Utilities.h"
+#include "LLU/Containers/Iterators/IterableContainer.hpp"
+#include "LLU/Containers/MArray.hpp"
+#include "LLU/Containers/NumericArray.h"
+#include "LLU/Containers/Tensor.h"
+#include "LLU/ErrorLog/ErrorManager.h"
+
+namespace LLU::Expr {
+
+	/// Minimal number of elements for which expressions are evaluated in parallel by the overloads of assign() and materialize() taking a thread pool
+	inline constexpr mint ParallelThreshold = mint {1} << 17U;
+
+	/// Base class of all expression nodes, used to recognize expressions in overload resolution
+	struct Node {};
+
+	/// @cond
+	namespace Detail {
+		template<typename C, typename = void>
+		struct is_container : std::false_type {};
+
+		template<typename C>
+		struct is_container<C, std::void_t<typename C::value_type>> : std::is_base_of<IterableContainer<typename C::value_type>, C> {};
+	}  // namespace Detail
+	/// @endcond
+
+	/// Check whether \p C is a container with contiguous data, i.e. a class derived from IterableContainer
+	template<typename C>
+	inline constexpr bool is_container_v = Detail::is_container<remove_cv_ref<C>>::value;
+
+	/// Check whether \p E is an expression node
+	template<typename E>
+	inline constexpr bool is_expression_v = std::is_base_of_v<Node, remove_cv_ref<E>>;
+
+	/// Check whether \p T can be an operand of an expression
+	template<typename T>
+	inline constexpr bool is_operand_v = is_container_v<T> || is_expression_v<T> || std::is_arithmetic_v<remove_cv_ref<T>>;
+
+	/**
+	 * @brief   Leaf of an expression which refers to the data of a container
+	 * @tparam  T - type of elements
+	 */
+	template<typename T>
+	class Terminal : public Node {
+	public:
+		/// Type of elements
+		using value_type = std::remove_cv_t<T>;
+
+		/**
+		 * @brief   Create a terminal referring to the data of a container, the container is not copied
+		 * @param   c - container derived from IterableContainer<T>
+		 */
+		template<class Container>
+		explicit Terminal(const Container& c) : buffer {c.data()}, length {c.size()} {
+			if constexpr (std::is_base_of_v<MArray<value_type>, Container>) {
+				dims = &c.dimensions();
+			}
+		}
+
+		/// Get the number of elements
+		[[nodiscard]] mint size() const noexcept {
+			return length;
+		}
+
+		/// Get dimensions of the container, if it has any, and nullptr otherwise
+		[[nodiscard]] const MArrayDimensions* dimensions() const noexcept {
+			return dims;
+		}
+
+		/// Get the element at \p index
+		value_type operator[](mint index) const noexcept {
+			return buffer[index];
+		}
+
+	private:
+		const T* buffer;
+		mint length;
+		const MArrayDimensions* dims = nullptr;
+	};
+
+	/**
+	 * @brief   Leaf of an expression which is a single number, broadcast to all positions
+	 * @tparam  T - type of the number
+	 */
+	template<typename T>
+	class Scalar : public Node {
+	public:
+		/// Type of the number
+		using value_type = T;
+
+		/// Create a scalar leaf
+		explicit Scalar(T v) : value {v} {}
+
+		/// Scalars fit expressions of any size, which is indicated with size -1
+		[[nodiscard]] static constexpr mint size() noexcept {
+			return -1;
+		}
+
+		/// Scalars have no dimensions
+		[[nodiscard]] static constexpr const MArrayDimensions* dimensions() noexcept {
+			return nullptr;
+		}
+
+		/// Get the number, regardless of the index
+		T operator[](mint /*index*/) const noexcept {
+			return value;
+		}
+
+	private:
+		T value;
+	};
+
+	/**
+	 * @brief   Expression node which applies a function to elements of its operands at the same position
+	 * @tparam  F - function object type
+	 * @tparam  Es - types of operand nodes
+	 */
+	template<typename F, typename... Es>
+	class Map : public Node {
+	public:
+		/// Type of the result of the function
+		using value_type = remove_cv_ref<std::invoke_result_t<const F&, typename Es::value_type...>>;
+
+		/**
+		 * @brief   Create a node applying \p f to operands
+		 * @param   f - function object
+		 * @param   es - operand nodes
+		 * @throws  ErrorName::DimensionsError - if operands which are not scalars have different sizes
+		 */
+		explicit Map(F f, Es... es) : length {commonSize({es.size()...})}, func {std::move(f)}, operands {std::move(es)...} {}
+
+		/// Get the number of elements, or -1 if all operands are scalars
+		[[nodiscard]] mint size() const noexcept {
+			return length;
+		}
+
+		/// Get dimensions of the first operand which has any, or nullptr
+		[[nodiscard]] const MArrayDimensions* dimensions() const noexcept {
+			return std::apply(
+				[](const auto&... es) {
+					const MArrayDimensions* res = nullptr;
+					((res = (res ? res : es.dimensions())), ...);
+					return res;
+				},
+				operands);
+		}
+
+		/// Compute the element at \p index
+		value_type operator[](mint index) const {
+			return std::apply([this, index](const auto&... es) { return static_cast<value_type>(func(es[index]...)); }, operands);
+		}
+
+	private:
+		static mint commonSize(std::initializer_list<mint> sizes) {
+			mint res = -1;
+			for (mint s : sizes) {
+				if (s < 0) {
+					continue;
+				}
+				if (res >= 0 && s != res) {
+					ErrorManager::throwExceptionWithDebugInfo(ErrorName::DimensionsError, "Operands of an expression have different sizes");
+				}
+				res = s;
+			}
+			return res;
+		}
+
+		mint length;
+		F func;
+		std::tuple<Es...> operands;
+	};
+
+	/**
+	 * @brief   Turn a container, an expression or a number into an expression node
+	 * @param   x - operand
+	 * @return  Terminal referring to the container data, the expression itself or a Scalar
+	 */
+	template<typename T>
+	auto lazy(const T& x) {
+		if constexpr (is_expression_v<T>) {
+			return x;
+		} else if constexpr (is_container_v<T>) {
+			return Terminal<typename T::value_type>(x);
+		} else {
+			static_assert(std::is_arithmetic_v<T>, "Only containers, expressions and numbers can be used in expressions.");
+			return Scalar<T>(x);
+		}
+	}
+
+	/**
+	 * @brief   Build an expression which applies \p f elementwise, e.g. <tt>map([](double x) { return std::sqrt(x); }, a)</tt>
+	 * @param   f - function object taking one argument per operand
+	 * @param   xs - containers, expressions or numbers
+	 * @return  new expression node
+	 */
+	template<typename F, typename... Ts>
+	auto map(F f, const Ts&... xs) {
+		return Map<F, decltype(lazy(xs))...>(std::move(f), lazy(xs)...);
+	}
+
+	/// @cond
+	namespace Detail {
+		template<typename L, typename R>
+		inline constexpr bool binary_operands_v =
+			is_operand_v<L> && is_operand_v<R> && (is_container_v<L> || is_container_v<R> || is_expression_v<L> || is_expression_v<R>);
+
+		template<typename E>
+		mint checkedSize(const E& e, mint expected) {
+			if (e.size() >= 0 && e.size() != expected) {
+				ErrorManager::throwExceptionWithDebugInfo(ErrorName::DimensionsError, "Expression size does not match the destination");
+			}
+			return expected;
+		}
+
+		template<typename T, typename E>
+		void evaluateRange(T* out, const E& e, mint first, mint last) {
+			for (mint i = first; i < last; ++i) {
+				out[i] = static_cast<T>(e[i]);
+			}
+		}
+
+		template<typename C>
+		C allocate(MArrayDimensions dims) {
+			using T = typename C::value_type;
+			if constexpr (std::is_same_v<C, NumericArray<T>>) {
+				return C {GenericNumericArray {NumericArrayType<T>, dims.rank(), dims.data()}};
+			} else if constexpr (std::is_same_v<C, Tensor<T>>) {
+				return C {GenericTensor {TensorType<T>, dims.rank(), dims.data()}};
+			} else {
+				return C {T {}, std::move(dims)};
+			}
+		}
+
+		template<typename E>
+		MArrayDimensions dimensionsOf(const E& e) {
+			if (e.size() < 0) {
+				ErrorManager::throwExceptionWithDebugInfo(ErrorName::DimensionsError, "Cannot materialize an expression without container operands");
+			}
+			return e.dimensions() ? *e.dimensions() : MArrayDimensions {e.size()};
+		}
+	}  // namespace Detail
+	/// @endcond
+
+	/**
+	 * @brief   Evaluate an expression and store the result in an existing container, in a single pass
+	 * @param   dst - destination container, derived from IterableContainer
+	 * @param   x - expression (or a container or a number, which is then copied to all elements)
+	 * @throws  ErrorName::DimensionsError - if the size of the expression differs from the size of \p dst
+	 */
+	template<class Dest, typename E>
+	void assign(Dest& dst, const E& x) {
+		static_assert(is_container_v<Dest>, "Destination of an expression must be a container derived from IterableContainer.");
+		const auto e = lazy(x);
+		Detail::evaluateRange(dst.data(), e, 0, Detail::checkedSize(e, dst.size()));
+	}
+
+	/**
+	 * @brief   Evaluate an expression and store the result in an existing container, in parallel if the container is large
+	 * @param   pool - thread pool, for example LLU::ThreadPool or LLU::BasicPool
+	 * @param   dst - destination container, derived from IterableContainer
+	 * @param   x - expression (or a container or a number, which is then copied to all elements)
+	 * @param   threshold - minimal number of elements for parallel evaluation, smaller expressions are evaluated in the calling thread
+	 * @param   chunkCount - number of tasks, by default the number of hardware threads
+	 * @throws  ErrorName::DimensionsError - if the size of the expression differs from the size of \p dst
+	 * @note    The calling thread evaluates one of the chunks, so this function must not be called from a task running on the same pool.
+	 */
+	template<typename Pool, class Dest, typename E>
+	void assign(Pool& pool, Dest& dst, const E& x, mint threshold = ParallelThreshold, unsigned chunkCount = std::thread::hardware_concurrency()) {
+		static_assert(is_container_v<Dest>, "Destination of an expression must be a container derived from IterableContainer.");
+		const auto e = lazy(x);
+		const mint n = Detail::checkedSize(e, dst.size());
+		auto* out = dst.data();
+		if (n < threshold || chunkCount < 2) {
+			Detail::evaluateRange(out, e, 0, n);
+			return;
+		}
+		// chunk bounds are multiples of 64 elements, so that no two tasks write to the same cache line
+		constexpr mint granularity = 64;
+		const mint chunks = std::min(static_cast<mint>(chunkCount), n);
+		const mint chunkLength = std::max(granularity, ((n + chunks - 1) / chunks + granularity - 1) / granularity * granularity);
+		Async::runTasks(pool, static_cast<std::size_t>((n + chunkLength - 1) / chunkLength), [out, &e, n, chunkLength](std::size_t chunk) {
+			const mint first = static_cast<mint>(chunk) * chunkLength;
+			Detail::evaluateRange(out, e, first, std::min(first + chunkLength, n));
+		});
+	}
+
+	/**
+	 * @brief   Evaluate an expression into a new container with dimensions of the first container operand that has dimensions
+	 * @tparam  Container - type of the result, e.g. NumericArray<double> or Tensor<mint>
+	 * @param   x - expression
+	 * @return  new container owned by the library
+	 * @note    NumericArrays and Tensors are allocated without initializing their elements in LLU, so the data is written only once.
+	 */
+	template<class Container, typename E>
+	Container materialize(const E& x) {
+		const auto e = lazy(x);
+		auto res = Detail::allocate<Container>(Detail::dimensionsOf(e));
+		assign(res, e);
+		return res;
+	}
+
+	/**
+	 * @brief   Evaluate an expression into a new container, in parallel if the expression is large
+	 * @tparam  Container - type of the result, e.g. NumericArray<double> or Tensor<mint>
+	 * @param   pool - thread pool, for example LLU::ThreadPool or LLU::BasicPool
+	 * @param   x - expression
+	 * @param   threshold - minimal number of elements for parallel evaluation
+	 * @param   chunkCount - number of tasks, by default the number of hardware threads
+	 * @return  new container owned by the library
+	 */
+	template<class Container, typename Pool, typename E>
+	Container materialize(Pool& pool, const E& x, mint threshold = ParallelThreshold, unsigned chunkCount = std::thread::hardware_concurrency()) {
+		const auto e = lazy(x);
+		auto res = Detail::allocate<Container>(Detail::dimensionsOf(e));
+		assign(pool, res, e, threshold, chunkCount);
+		return res;
+	}
+
+	/// Elementwise sum
+	template<typename L, typename R, typename = std::enable_if_t<Detail::binary_operands_v<L, R>>>
+	auto operator+(const L& l, const R& r) {
+		return map(std::plus<> {}, l, r);
+	}
+
+	/// Elementwise difference
+	template<typename L, typename R, typename = std::enable_if_t<Detail::binary_operands_v<L, R>>>
+	auto operator-(const L& l, const R& r) {
+		return map(std::minus<> {}, l, r);
+	}
+
+	/// Elementwise product
+	template<typename L, typename R, typename = std::enable_if_t<Detail::binary_operands_v<L, R>>>
+	auto operator*(const L& l, const R& r) {
+		return map(std::multiplies<> {}, l, r);
+	}
+
+	/// Elementwise quotient
+	template<typename L, typename R, typename = std::enable_if_t<Detail::binary_operands_v<L, R>>>
+	auto operator/(const L& l, const R& r) {
+		return map(std::divides<> {}, l, r);
+	}
+
+	/// Elementwise negation
+	template<typename E, typename = std::enable_if_t<is_container_v<E> || is_expression_v<E>>>
+	auto operator-(const E& e) {
+		return map(std::negate<> {}, e);
+	}
+
+}  // namespace LLU::Expr
+
+namespace LLU {
+	// Make the operators visible to argument-dependent lookup for containers, which live in namespace LLU
+	using Expr::operator+;
+	using Expr::operator-;
+	using Expr::operator*;
+	using Expr::operator/;
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_EXPRESSIONS_HPP
@@ -6,6 +6,10 @@
 #ifndef LLU_CONTAINERS_GENERIC_DATASTORE_HPP
 #define LLU_CONTAINERS_GENERIC_DATASTORE_HPP
 
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
 #include "LLU/Containers/Generic/Base.hpp"
 #include "LLU/Containers/Iterators/DataStore.hpp"
 #include "LLU/MArgument.h"
@@ -181,6 +185,16 @@ namespace LLU {
 		 */
 		void push_back(std::string_view name, const Argument::Typed::Any& node);
 
+		/**
+		 * @brief   Move all nodes of another DataStore to the end of this one, leaving \p other empty
+		 * @param   other - a DataStore whose nodes are moved
+		 * @note    If this DataStore is empty and both DataStores are owned by the library, they simply swap their raw DataStores and nothing is copied.
+		 *          Otherwise each node value of \p other is copied exactly once, since the DataStore API has no way of detaching a value from a node,
+		 *          and the raw DataStore of \p other is released immediately. This is never worse than clone() followed by pushing copies of nodes.
+		 *          Appending a DataStore to itself does nothing.
+		 */
+		void append(MContainer&& other);
+
 	private:
 		/// Make a deep copy of the raw container
 		Container cloneImpl() const override {
@@ -205,6 +219,70 @@ namespace LLU {
 		}
 	};
 
+	/**
+	 * @class   DataStoreIndex
+	 * @brief   Random-access index over nodes of a DataStore.
+	 * @details DataStore is a singly linked list, so reaching the n-th node or a node with given name takes a walk from the front with an API call per node.
+	 *          DataStoreIndex makes this walk once and stores all nodes in a vector. A hash table of node names is built on the first lookup by name.
+	 *          The index does not own the DataStore and does not notice new nodes unless they are added with append().
+	 */
+	class DataStoreIndex {
+	public:
+		/// Create an empty index
+		DataStoreIndex() = default;
+
+		/**
+		 * @brief   Create an index of all nodes of a DataStore
+		 * @param   ds - raw DataStore
+		 */
+		explicit DataStoreIndex(DataStore ds);
+
+		/**
+		 * @brief   Add a node to the index, the node must be the new last node of the indexed DataStore
+		 * @param   node - a node that was just added to the DataStore
+		 */
+		void append(DataStoreNode node);
+
+		/// Get the number of indexed nodes
+		[[nodiscard]] mint size() const noexcept {
+			return static_cast<mint>(nodes.size());
+		}
+
+		/**
+		 * @brief   Get node at given position
+		 * @param   position - index of a node, must be smaller than size()
+		 * @return  raw node at given position
+		 */
+		DataStoreNode operator[](mint position) const noexcept {
+			return nodes[static_cast<std::size_t>(position)];
+		}
+
+		/**
+		 * @brief   Get node at given position, with bounds checking
+		 * @param   position - index of a node
+		 * @return  raw node at given position
+		 * @throws  ErrorName::DLIndexError - if \p position is out of range
+		 */
+		DataStoreNode at(mint position) const;
+
+		/**
+		 * @brief   Find the first node with given name
+		 * @param   name - node name
+		 * @return  first node with given name or nullptr if there is no such node
+		 */
+		DataStoreNode find(std::string_view name);
+
+	private:
+		/// All nodes of the DataStore, in order
+		std::vector<DataStoreNode> nodes;
+
+		/// Map from node names to the first node with that name, the names are owned by the DataStore
+		std::unordered_map<std::string_view, DataStoreNode> names;
+
+		/// Whether the names table has already been built
+		bool namesIndexed = false;
+	};
+
 	template<typename T, GenericDataList::EnableIfArgumentType<T>>
 	void GenericDataList::push_back(T nodeValue) {
 		static_assert(!std::is_same_v<T, MTensor>, "Do not use push_back templated on the argument type with MTensor or MNumericArray.");
@@ -231,12 +309,25 @@ namespace LLU {
 
 	template<typename T>
 	T GenericDataNode::as() const {
-		auto v = value();
-		auto* ptr = std::get_if<T>(std::addressof(v));
-		if (!ptr) {
-			ErrorManager::throwException(ErrorName::DLInvalidNodeType);
+		if constexpr (std::is_same_v<T, Argument::TypedArgument>) {
+			return value();
+		} else {
+			if (type() != Argument::WrapperIndex<T>) {
+				ErrorManager::throwException(ErrorName::DLInvalidNodeType);
+			}
+			return asUnchecked<T>();
+		}
+	}
+
+	template<typename T>
+	T GenericDataNode::asUnchecked() const {
+		if constexpr (std::is_same_v<T, Argument::TypedArgument>) {
+			return value();
+		} else {
+			constexpr MArgumentType Type = Argument::WrapperIndex<T>;
+			MArgument m = rawValue();
+			return Argument::toWrapperType<Type>(PrimitiveWrapper<Type> {m}.get());
 		}
-		return std::move(*ptr);
 	}
 }  // namespace LLU
 
@@ -0,0 +1,163 @@
+/**
+ * @file
+ * @brief   GenericSparseArray definition and implementation
+ */
+
+#ifndef LLU_CONTAINERS_GENERIC_SPARSEARRAY_HPP
+#define LLU_CONTAINERS_GENERIC_SPARSEARRAY_HPP
+
+#include "LLU/Containers/Generic/Base.hpp"
+#include "LLU/Containers/Generic/Tensor.hpp"
+
+namespace LLU {
+
+	template<>
+	class MContainer<MArgumentType::SparseArray>;
+
+	/// MContainer specialization for MSparseArray is called GenericSparseArray
+	using GenericSparseArray = MContainer<MArgumentType::SparseArray>;
+
+	/**
+	 *  @brief  MContainer specialization for MSparseArray
+	 *
+	 *  MSparseArray stores its data in the compressed sparse row (CSR) format. The row pointers, column indices and explicit values are MTensors
+	 *  owned by the MSparseArray and they can be accessed without copying as long as the sparse array is alive.
+	 */
+	template<>
+	class MContainer<MArgumentType::SparseArray> : public MContainerBase<MArgumentType::SparseArray> {
+	public:
+		/// Inherit constructors from MContainerBase
+		using MContainerBase<MArgumentType::SparseArray>::MContainerBase;
+
+		/// Default constructor, the MContainer does not manage any instance of MSparseArray.
+		MContainer() = default;
+
+		/**
+		 * @brief   Create GenericSparseArray from explicit positions and values (COO format)
+		 * @param   positions - integer matrix of shape {nnz, rank} with 1-based positions of explicit values
+		 * @param   values - tensor of length nnz with explicit values
+		 * @param   dimensions - integer vector with dimensions of the new sparse array
+		 * @param   implicitValue - rank 0 tensor with the implicit value, it must have the same type as \p values
+		 * @see     <http://reference.wolfram.com/language/LibraryLink/ref/callback/MSparseArray_fromExplicitPositions.html>
+		 */
+		MContainer(const GenericTensor& positions, const GenericTensor& values, const GenericTensor& dimensions, const GenericTensor& implicitValue);
+
+		/**
+		 * @brief   Create GenericSparseArray from a dense tensor
+		 * @param   data - dense tensor to be converted to a sparse array
+		 * @param   implicitValue - rank 0 tensor with the implicit value, elements of \p data equal to it will not be stored explicitly
+		 * @see     <http://reference.wolfram.com/language/LibraryLink/ref/callback/MSparseArray_fromMTensor.html>
+		 */
+		MContainer(const GenericTensor& data, const GenericTensor& implicitValue);
+
+		/**
+		 * @brief   Clone this MContainer, performs a deep copy of the underlying MSparseArray.
+		 * @note    The cloned MContainer always belongs to the library (Ownership::Library) because LibraryLink has no idea of its existence.
+		 * @return  new MContainer, by value
+		 */
+		MContainer clone() const {
+			return MContainer {cloneContainer(), Ownership::Library};
+		}
+
+		/**
+		 * @brief   Get the rank of the sparse array
+		 * @see     <http://reference.wolfram.com/language/LibraryLink/ref/callback/MSparseArray_getRank.html>
+		 */
+		mint getRank() const {
+			return LibraryData::SparseArrayAPI()->MSparseArray_getRank(this->getContainer());
+		}
+
+		/**
+		 * @brief   Get dimensions of the sparse array
+		 * @see     <http://reference.wolfram.com/language/LibraryLink/ref/callback/MSparseArray_getDimensions.html>
+		 */
+		mint const* getDimensions() const {
+			return LibraryData::SparseArrayAPI()->MSparseArray_getDimensions(this->getContainer());
+		}
+
+		/**
+		 * @brief   Get the data type of the sparse array, which is the type of its implicit and explicit values (MType_Integer, MType_Real or MType_Complex)
+		 */
+		mint type() const {
+			return LibraryData::API()->MTensor_getType(implicitValueTensor());
+		}
+
+		/**
+		 * @brief   Get the implicit value as a rank 0 MTensor owned by the sparse array
+		 * @see     <http://reference.wolfram.com/language/LibraryLink/ref/callback/MSparseArray_getImplicitValue.html>
+		 */
+		MTensor implicitValueTensor() const {
+			return *LibraryData::SparseArrayAPI()->MSparseArray_getImplicitValue(this->getContainer());
+		}
+
+		/**
+		 * @brief   Get the explicit values (CSR values) as a vector MTensor owned by the sparse array
+		 * @see     <http://reference.wolfram.com/language/LibraryLink/ref/callback/MSparseArray_getExplicitValues.html>
+		 */
+		MTensor explicitValuesTensor() const {
+			return *LibraryData::SparseArrayAPI()->MSparseArray_getExplicitValues(this->getContainer());
+		}
+
+		/**
+		 * @brief   Get the CSR row pointers as an integer vector MTensor owned by the sparse array
+		 * @see     <http://reference.wolfram.com/language/LibraryLink/ref/callback/MSparseArray_getRowPointers.html>
+		 */
+		MTensor rowPointersTensor() const {
+			return *LibraryData::SparseArrayAPI()->MSparseArray_getRowPointers(this->getContainer());
+		}
+
+		/**
+		 * @brief   Get the CSR column indices as an integer matrix MTensor owned by the sparse array
+		 * @see     <http://reference.wolfram.com/language/LibraryLink/ref/callback/MSparseArray_getColumnIndices.html>
+		 */
+		MTensor columnIndicesTensor() const {
+			return *LibraryData::SparseArrayAPI()->MSparseArray_getColumnIndices(this->getContainer());
+		}
+
+		/**
+		 * @brief   Compute 1-based positions of all explicit values (COO format)
+		 * @return  new integer matrix of shape {nnz, rank}, owned by the library
+		 * @see     <http://reference.wolfram.com/language/LibraryLink/ref/callback/MSparseArray_getExplicitPositions.html>
+		 */
+		GenericTensor getExplicitPositions() const;
+
+		/**
+		 * @brief   Create a dense tensor with the same contents as this sparse array
+		 * @return  new dense tensor, owned by the library
+		 * @see     <http://reference.wolfram.com/language/LibraryLink/ref/callback/MSparseArray_toMTensor.html>
+		 */
+		GenericTensor toGenericTensor() const;
+
+		/**
+		 * @brief   Change the implicit value of the sparse array. Internally a new MSparseArray is created and replaces the current one.
+		 * @param   implicitValue - rank 0 tensor with the new implicit value
+		 * @note    The new MSparseArray always belongs to the library (Ownership::Library)
+		 * @see     <http://reference.wolfram.com/language/LibraryLink/ref/callback/MSparseArray_resetImplicitValue.html>
+		 */
+		void resetImplicitValue(const GenericTensor& implicitValue);
+
+	private:
+
+		/**
+		 * @copydoc MContainer<MArgumentType::Image>::shareCount()
+		 * @see 	<http://reference.wolfram.com/language/LibraryLink/ref/callback/MSparseArray_shareCount.html>
+		 */
+		mint shareCountImpl() const noexcept override {
+			return LibraryData::SparseArrayAPI()->MSparseArray_shareCount(this->getContainer());
+		}
+
+		/// @copydoc   MContainer<MArgumentType::DataStore>::pass
+		void passImpl(MArgument& res) const noexcept override {
+			MArgument_setMSparseArray(res, this->getContainer());
+		}
+
+		/**
+		 *   @brief   Make a deep copy of the raw container
+		 *   @see 		<http://reference.wolfram.com/language/LibraryLink/ref/callback/MSparseArray_clone.html>
+		 **/
+		Container cloneImpl() const override;
+	};
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_GENERIC_SPARSEARRAY_HPP
@@ -33,6 +33,7 @@ namespace LLU {
 		 *   @param[in]     col - pixel column (in Mathematica-style indexing - starting from 1)
 		 *   @param[in]     channel - desired channel (in Mathematica-style indexing - starting from 1)
 		 *   @throws		ErrorName::ImageIndexError - if the specified coordinates are out-of-bound
+		 *   @note          Every call goes through LibraryLink API, use ImageAccessor to process large parts of an image
 		 **/
 		T get(mint row, mint col, mint channel) const {
 			std::array<mint, 2> pos {{row, col}};
@@ -59,6 +60,7 @@ namespace LLU {
 		 *   @param[in]     channel - desired channel (in Mathematica-style indexing - starting from 1)
 		 *   @param[in]		newValue - new channel value
 		 *   @throws		ErrorName::ImageIndexError - if the specified coordinates are out-of-bound
+		 *   @note          Every call goes through LibraryLink API, use ImageAccessor to process large parts of an image
 		 **/
 		void set(mint row, mint col, mint channel, T newValue) {
 			std::array<mint, 2> pos {{row, col}};
@@ -0,0 +1,213 @@
+/**
+ * @file	ImageLayout.hpp
+ * @brief	Conversion between interleaved and planar layouts of Image data, without going through MImage_convertType.
+ *
+ * In an interleaved image all channel values of a pixel are adjacent in memory, in a planar image each channel is stored as a separate block
+ * of slices * rows * columns values. Functions in this file copy data between the two layouts into a preallocated Image, optionally splitting
+ * the work on a thread pool. The pixels are processed in tiles small enough to keep both the source and destination lines in cache, and kernels
+ * for 1 to 4 channels are generated with the channel count known at compile time so that the compiler can vectorize them.
+ */
+#ifndef LLU_CONTAINERS_IMAGELAYOUT_HPP
+#define LLU_CONTAINERS_IMAGELAYOUT_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+#include "LLU/Async/Utilities.h"
+#include "LLU/Containers/Image.h"
+#include "LLU/ErrorLog/ErrorManager.h"
+
+namespace LLU::Layout {
+
+	/// Number of pixels processed at once by the layout conversion kernels
+	inline constexpr mint TileSize = 2048;
+
+	/**
+	 * @brief   Copy channel planes into interleaved pixels, for pixels in the range [first, last)
+	 * @param   planar - pointer to the first plane, planes are \p planeStride elements apart
+	 * @param   interleaved - pointer to interleaved data with \p channels values per pixel
+	 * @param   channels - number of channels
+	 * @param   planeStride - distance (in elements) between consecutive planes, i.e. number of pixels in the image
+	 * @param   first - index of the first pixel to convert
+	 * @param   last - index one past the last pixel to convert
+	 */
+	template<typename T>
+	void interleave(const T* planar, T* interleaved, mint channels, mint planeStride, mint first, mint last);
+
+	/**
+	 * @brief   Copy interleaved pixels into separate channel planes, for pixels in the range [first, last)
+	 * @param   interleaved - pointer to interleaved data with \p channels values per pixel
+	 * @param   planar - pointer to the first plane, planes are \p planeStride elements apart
+	 * @param   channels - number of channels
+	 * @param   planeStride - distance (in elements) between consecutive planes, i.e. number of pixels in the image
+	 * @param   first - index of the first pixel to convert
+	 * @param   last - index one past the last pixel to convert
+	 */
+	template<typename T>
+	void deinterleave(const T* interleaved, T* planar, mint channels, mint planeStride, mint first, mint last);
+
+	/// @cond
+	namespace Detail {
+		template<mint Channels, typename T>
+		void interleaveFixed(const T* planar, T* interleaved, mint planeStride, mint first, mint last) {
+			for (mint p = first; p < last; ++p) {
+				for (mint c = 0; c < Channels; ++c) {
+					interleaved[p * Channels + c] = planar[c * planeStride + p];
+				}
+			}
+		}
+
+		template<mint Channels, typename T>
+		void deinterleaveFixed(const T* interleaved, T* planar, mint planeStride, mint first, mint last) {
+			for (mint p = first; p < last; ++p) {
+				for (mint c = 0; c < Channels; ++c) {
+					planar[c * planeStride + p] = interleaved[p * Channels + c];
+				}
+			}
+		}
+
+		/// Check that two images hold the same number of pixels and channels and return the number of pixels
+		inline mint pixelCount(const ImageInterface& src, const ImageInterface& dst) {
+			const mint srcSlices = src.is3D() ? src.slices() : 1;
+			const mint dstSlices = dst.is3D() ? dst.slices() : 1;
+			if (srcSlices != dstSlices || src.rows() != dst.rows() || src.columns() != dst.columns() || src.channels() != dst.channels()) {
+				ErrorManager::throwExceptionWithDebugInfo(ErrorName::ImageSizeError, "Layout conversion requires images of the same dimensions");
+			}
+			return srcSlices * src.rows() * src.columns();
+		}
+
+		/// Convert pixels [first, last) from the layout of src to the layout of dst
+		template<typename T>
+		void convertRange(const T* src, bool srcInterleaved, T* dst, bool dstInterleaved, mint channels, mint pixels, mint first, mint last) {
+			if (srcInterleaved == dstInterleaved) {
+				if (srcInterleaved) {
+					std::memcpy(dst + first * channels, src + first * channels, static_cast<size_t>((last - first) * channels) * sizeof(T));
+				} else {
+					for (mint c = 0; c < channels; ++c) {
+						std::memcpy(dst + c * pixels + first, src + c * pixels + first, static_cast<size_t>(last - first) * sizeof(T));
+					}
+				}
+			} else if (dstInterleaved) {
+				interleave(src, dst, channels, pixels, first, last);
+			} else {
+				deinterleave(src, dst, channels, pixels, first, last);
+			}
+		}
+	}  // namespace Detail
+	/// @endcond
+
+	template<typename T>
+	void interleave(const T* planar, T* interleaved, mint channels, mint planeStride, mint first, mint last) {
+		for (mint tile = first; tile < last; tile += TileSize) {
+			const mint tileEnd = std::min(tile + TileSize, last);
+			switch (channels) {
+				case 1: std::memcpy(interleaved + tile, planar + tile, static_cast<size_t>(tileEnd - tile) * sizeof(T)); break;
+				case 2: Detail::interleaveFixed<2>(planar, interleaved, planeStride, tile, tileEnd); break;
+				case 3: Detail::interleaveFixed<3>(planar, interleaved, planeStride, tile, tileEnd); break;
+				case 4: Detail::interleaveFixed<4>(planar, interleaved, planeStride, tile, tileEnd); break;
+				default:
+					// read each plane contiguously, the writes stay within a single tile of the destination
+					for (mint c = 0; c < channels; ++c) {
+						const T* in = planar + c * planeStride;
+						for (mint p = tile; p < tileEnd; ++p) {
+							interleaved[p * channels + c] = in[p];
+						}
+					}
+			}
+		}
+	}
+
+	template<typename T>
+	void deinterleave(const T* interleaved, T* planar, mint channels, mint planeStride, mint first, mint last) {
+		for (mint tile = first; tile < last; tile += TileSize) {
+			const mint tileEnd = std::min(tile + TileSize, last);
+			switch (channels) {
+				case 1: std::memcpy(planar + tile, interleaved + tile, static_cast<size_t>(tileEnd - tile) * sizeof(T)); break;
+				case 2: Detail::deinterleaveFixed<2>(interleaved, planar, planeStride, tile, tileEnd); break;
+				case 3: Detail::deinterleaveFixed<3>(interleaved, planar, planeStride, tile, tileEnd); break;
+				case 4: Detail::deinterleaveFixed<4>(interleaved, planar, planeStride, tile, tileEnd); break;
+				default:
+					// write each plane contiguously, the reads stay within a single tile of the source
+					for (mint c = 0; c < channels; ++c) {
+						T* out = planar + c * planeStride;
+						for (mint p = tile; p < tileEnd; ++p) {
+							out[p] = interleaved[p * channels + c];
+						}
+					}
+			}
+		}
+	}
+
+	/**
+	 * @brief   Copy data of an image into a preallocated image of the same type and dimensions, converting between interleaved and planar layout
+	 *          if the two images differ in interleaving.
+	 * @param   src - source image
+	 * @param   dst - destination image, must have the same number of slices, rows, columns and channels as \p src
+	 * @throws  ErrorName::ImageSizeError - if dimensions of the images do not match
+	 */
+	template<typename T>
+	void convertLayout(const Image<T>& src, Image<T>& dst) {
+		const mint pixels = Detail::pixelCount(src, dst);
+		Detail::convertRange(src.data(), src.interleavedQ(), dst.data(), dst.interleavedQ(), src.channels(), pixels, 0, pixels);
+	}
+
+	/**
+	 * @brief   Copy data of an image into a preallocated image converting the layout, splitting the pixels into chunks processed on a thread pool
+	 * @param   pool - thread pool, for example LLU::ThreadPool or LLU::BasicPool
+	 * @param   src - source image
+	 * @param   dst - destination image, must have the same number of slices, rows, columns and channels as \p src
+	 * @param   chunkCount - number of chunks, by default the number of hardware threads
+	 * @throws  ErrorName::ImageSizeError - if dimensions of the images do not match
+	 * @note    The calling thread converts one of the chunks and waits for the others, so this function must not be called from a task running on
+	 *          the same pool. Chunks are aligned to the tile size and span slice boundaries, so large 3D images are split evenly.
+	 */
+	template<typename Pool, typename T>
+	void convertLayout(Pool& pool, const Image<T>& src, Image<T>& dst, unsigned chunkCount = std::thread::hardware_concurrency()) {
+		const mint pixels = Detail::pixelCount(src, dst);
+		const mint tiles = (pixels + TileSize - 1) / TileSize;
+		const mint chunks = std::clamp<mint>(chunkCount, 1, std::max<mint>(tiles, 1));
+		const mint tilesPerChunk = (tiles + chunks - 1) / chunks;
+		const T* in = src.data();
+		T* out = dst.data();
+		const bool srcInterleaved = src.interleavedQ();
+		const bool dstInterleaved = dst.interleavedQ();
+		const mint channels = src.channels();
+		Async::runTasks(pool, static_cast<size_t>(chunks), [=](size_t chunk) {
+			const mint first = std::min(static_cast<mint>(chunk) * tilesPerChunk * TileSize, pixels);
+			const mint last = std::min(first + tilesPerChunk * TileSize, pixels);
+			Detail::convertRange(in, srcInterleaved, out, dstInterleaved, channels, pixels, first, last);
+		});
+	}
+
+	/**
+	 * @brief   Create a copy of an image with given interleaving. Contrary to Image<T>::convert, data type conversion is never performed.
+	 * @param   src - source image
+	 * @param   interleaved - interleaving of the new image
+	 * @return  new image owned by the library
+	 */
+	template<typename T>
+	Image<T> withLayout(const Image<T>& src, bool interleaved) {
+		Image<T> dst {src.is3D() ? src.slices() : 0, src.columns(), src.rows(), src.channels(), src.colorspace(), interleaved};
+		convertLayout(src, dst);
+		return dst;
+	}
+
+	/**
+	 * @brief   Create a copy of an image with given interleaving, converting the data on a thread pool
+	 * @param   pool - thread pool, for example LLU::ThreadPool or LLU::BasicPool
+	 * @param   src - source image
+	 * @param   interleaved - interleaving of the new image
+	 * @param   chunkCount - number of chunks, by default the number of hardware threads
+	 * @return  new image owned by the library
+	 */
+	template<typename Pool, typename T>
+	Image<T> withLayout(Pool& pool, const Image<T>& src, bool interleaved, unsigned chunkCount = std::thread::hardware_concurrency()) {
+		Image<T> dst {src.is3D() ? src.slices() : 0, src.columns(), src.rows(), src.channels(), src.colorspace(), interleaved};
+		convertLayout(pool, src, dst, chunkCount);
+		return dst;
+	}
+
+}  // namespace LLU::Layout
+
+#endif	  // LLU_CONTAINERS_IMAGELAYOUT_HPP
@@ -0,0 +1,470 @@
+/**
+ * @file	ImageTiles.hpp
+ * @brief	Tile-based framework for neighbourhood operations on 2D and 3D images.
+ *
+ * An image is split into tiles small enough to stay in cache. For every tile, the framework copies the tile together with a surrounding halo into
+ * a contiguous per-channel buffer, resolving pixels outside of the image according to a border policy, and then calls a user-provided kernel.
+ * Since the halo is already filled in, kernels need no special handling near image borders. Tiles can be processed in parallel on a thread pool.
+ */
+#ifndef LLU_CONTAINERS_IMAGETILES_HPP
+#define LLU_CONTAINERS_IMAGETILES_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "LLU/Async/Utilities.h"
+#include "LLU/Containers/Views/ImageAccessor.hpp"
+#include "LLU/ErrorLog/ErrorManager.h"
+
+namespace LLU::Tiling {
+
+	/// How to obtain values of pixels outside of the image
+	enum class Border {
+		Constant,	 ///< use a fixed value, like Padding -> value in the Wolfram Language
+		Clamp,		 ///< repeat the closest edge pixel, like Padding -> "Fixed"
+		Reflect,	 ///< mirror the image around the edge pixel, like Padding -> "Reflected"
+		Wrap		 ///< treat the image as periodic, like Padding -> "Periodic"
+	};
+
+	/// Size or position along the three spatial axes of an image. For 2D images the number of slices is 1.
+	struct Extent {
+		mint slices = 0;
+		mint rows = 0;
+		mint columns = 0;
+	};
+
+	/// Part of an image processed as a unit, positions are 0-based
+	struct Region {
+		Extent origin;
+		Extent size;
+	};
+
+	/// Default tile size, a tile of 8 x 64 x 256 values of one channel fits in L2 cache for all image data types
+	inline constexpr Extent DefaultTileSize {8, 64, 256};
+
+	/// Parameters of tiled processing
+	struct Options {
+		/// Maximal size of a tile, the last tile along each axis may be smaller
+		Extent tileSize = DefaultTileSize;
+
+		/// Number of extra pixels on each side of a tile that the kernel can read, slices are ignored for 2D images
+		Extent halo {0, 0, 0};
+
+		/// How to fill parts of the halo that lie outside of the image
+		Border border = Border::Reflect;
+
+		/// Value used for Border::Constant
+		double borderValue = 0.;
+	};
+
+	/**
+	 * @brief   Map a position along one axis to a valid position in the image according to a border policy
+	 * @param   i - position, possibly outside of the image
+	 * @param   n - size of the image along the axis
+	 * @param   border - border policy
+	 * @return  position in the range [0, n), or -1 if the pixel should take the constant border value
+	 */
+	inline mint resolveIndex(mint i, mint n, Border border) noexcept {
+		if (i >= 0 && i < n) {
+			return i;
+		}
+		switch (border) {
+			case Border::Clamp: return i < 0 ? 0 : n - 1;
+			case Border::Reflect: {
+				if (n == 1) {
+					return 0;
+				}
+				const mint period = 2 * (n - 1);
+				i %= period;
+				if (i < 0) {
+					i += period;
+				}
+				return i < n ? i : period - i;
+			}
+			case Border::Wrap: i %= n; return i < 0 ? i + n : i;
+			default: return -1;
+		}
+	}
+
+	/**
+	 * @brief   Contents of a single tile of an image together with its halo, stored channel by channel in a contiguous buffer.
+	 *
+	 * Positions passed to the accessors are relative to the origin of the tile and may extend into the halo, i.e. a row index must be in the range
+	 * [-halo().rows, rows() + halo().rows) and similarly for slices and columns.
+	 * @tparam  T - image data type
+	 */
+	template<typename T>
+	class Tile {
+	public:
+		/// Type of channel values
+		using value_type = T;
+
+		/**
+		 * @brief   Create an empty tile
+		 * @param   halo - size of the halo around the tile
+		 * @param   channels - number of channels
+		 */
+		Tile(const Extent& halo, mint channels) : haloSize {halo}, channelCount {channels} {}
+
+		/**
+		 * @brief   Copy given region of an image, extended by the halo, into the tile
+		 * @param   src - accessor to the image data
+		 * @param   region - part of the image to load
+		 * @param   border - border policy for pixels outside of the image
+		 * @param   borderValue - value used with Border::Constant
+		 */
+		void load(const ImageAccessor<const T>& src, const Region& region, Border border, T borderValue) {
+			tileRegion = region;
+			const Extent padded {region.size.slices + 2 * haloSize.slices, region.size.rows + 2 * haloSize.rows,
+								 region.size.columns + 2 * haloSize.columns};
+			rowStride = padded.columns;
+			sliceStride = padded.rows * rowStride;
+			channelStride = padded.slices * sliceStride;
+			buffer.resize(static_cast<size_t>(channelStride * channelCount));
+
+			// columns [innerBegin, innerEnd) of the padded line lie inside the image
+			const mint firstColumn = region.origin.columns - haloSize.columns;
+			const mint innerBegin = std::clamp<mint>(-firstColumn, 0, padded.columns);
+			const mint innerEnd = std::clamp<mint>(src.columns() - firstColumn, innerBegin, padded.columns);
+			for (mint ch = 0; ch < channelCount; ++ch) {
+				for (mint z = 0; z < padded.slices; ++z) {
+					const mint sz = resolveIndex(region.origin.slices + z - haloSize.slices, src.slices(), border);
+					for (mint y = 0; y < padded.rows; ++y) {
+						const mint sy = resolveIndex(region.origin.rows + y - haloSize.rows, src.rows(), border);
+						T* out = buffer.data() + ch * channelStride + z * sliceStride + y * rowStride;
+						if (sz < 0 || sy < 0) {
+							std::fill_n(out, padded.columns, borderValue);
+							continue;
+						}
+						auto srcRow = src.row(sy, ch, sz);
+						for (mint x = 0; x < innerBegin; ++x) {
+							const mint sx = resolveIndex(firstColumn + x, src.columns(), border);
+							out[x] = sx < 0 ? borderValue : srcRow[sx];
+						}
+						if (srcRow.contiguousQ()) {
+							std::copy_n(srcRow.data() + firstColumn + innerBegin, innerEnd - innerBegin, out + innerBegin);
+						} else {
+							for (mint x = innerBegin; x < innerEnd; ++x) {
+								out[x] = srcRow[firstColumn + x];
+							}
+						}
+						for (mint x = innerEnd; x < padded.columns; ++x) {
+							const mint sx = resolveIndex(firstColumn + x, src.columns(), border);
+							out[x] = sx < 0 ? borderValue : srcRow[sx];
+						}
+					}
+				}
+			}
+		}
+
+		/// Get value at given position in a 3D tile, relative to the tile origin
+		const T& operator()(mint slice, mint row, mint col, mint channel) const noexcept {
+			return buffer[static_cast<size_t>(channel * channelStride + (slice + haloSize.slices) * sliceStride + (row + haloSize.rows) * rowStride +
+											  col + haloSize.columns)];
+		}
+
+		/// Get value at given position in a 2D tile, relative to the tile origin
+		const T& operator()(mint row, mint col, mint channel) const noexcept {
+			return (*this)(0, row, col, channel);
+		}
+
+		/**
+		 * @brief   Get pointer to the value in column 0 of given line of the tile. The line continues contiguously in both directions through the halo.
+		 * @param   slice - slice index relative to the tile origin
+		 * @param   row - row index relative to the tile origin
+		 * @param   channel - channel index
+		 */
+		const T* line(mint slice, mint row, mint channel) const noexcept {
+			return &(*this)(slice, row, 0, channel);
+		}
+
+		/// Get the part of the image covered by this tile, without the halo
+		const Region& region() const noexcept {
+			return tileRegion;
+		}
+
+		/// Get the size of the halo
+		const Extent& halo() const noexcept {
+			return haloSize;
+		}
+
+		/// Get number of slices in the tile, without the halo
+		mint slices() const noexcept {
+			return tileRegion.size.slices;
+		}
+
+		/// Get number of rows in the tile, without the halo
+		mint rows() const noexcept {
+			return tileRegion.size.rows;
+		}
+
+		/// Get number of columns in the tile, without the halo
+		mint columns() const noexcept {
+			return tileRegion.size.columns;
+		}
+
+		/// Get number of channels
+		mint channels() const noexcept {
+			return channelCount;
+		}
+
+	private:
+		std::vector<T> buffer;
+		Region tileRegion;
+		Extent haloSize;
+		mint channelCount = 0;
+		mint rowStride = 0;
+		mint sliceStride = 0;
+		mint channelStride = 0;
+	};
+
+	/**
+	 * @brief   Split an image into tiles
+	 * @param   imageSize - number of slices (1 for 2D images), rows and columns of the image
+	 * @param   tileSize - maximal size of a tile
+	 * @return  list of regions covering the whole image, in slice-row-column order
+	 */
+	inline std::vector<Region> makeTiles(const Extent& imageSize, const Extent& tileSize) {
+		const Extent step {std::max<mint>(tileSize.slices, 1), std::max<mint>(tileSize.rows, 1), std::max<mint>(tileSize.columns, 1)};
+		std::vector<Region> tiles;
+		for (mint z = 0; z < imageSize.slices; z += step.slices) {
+			for (mint y = 0; y < imageSize.rows; y += step.rows) {
+				for (mint x = 0; x < imageSize.columns; x += step.columns) {
+					tiles.push_back({{z, y, x},
+									 {std::min(step.slices, imageSize.slices - z), std::min(step.rows, imageSize.rows - y),
+									  std::min(step.columns, imageSize.columns - x)}});
+				}
+			}
+		}
+		return tiles;
+	}
+
+	/// @cond
+	namespace Detail {
+		/// Check that source and destination images have the same spatial dimensions and return them
+		template<typename T, typename U>
+		Extent imageExtent(const ImageAccessor<const T>& src, const ImageAccessor<U>& dst) {
+			if (src.slices() != dst.slices() || src.rows() != dst.rows() || src.columns() != dst.columns()) {
+				ErrorManager::throwExceptionWithDebugInfo(ErrorName::ImageSizeError, "Tiled processing requires images of the same dimensions");
+			}
+			return {src.slices(), src.rows(), src.columns()};
+		}
+
+		/// Halo used for given image, there is no halo across slices of a 2D image
+		inline Extent effectiveHalo(const Extent& halo, bool is3D) {
+			return {is3D ? halo.slices : 0, halo.rows, halo.columns};
+		}
+
+		/// Process tiles with indices taken from a shared counter until all are done
+		template<typename T, typename U, typename F>
+		void processTiles(const ImageAccessor<const T>& src, const ImageAccessor<U>& dst, const std::vector<Region>& tiles, std::atomic<size_t>& next,
+						  const Extent& halo, const Options& opts, F& kernel) {
+			Tile<T> tile {halo, src.channels()};
+			const auto borderValue = static_cast<T>(opts.borderValue);
+			for (auto i = next++; i < tiles.size(); i = next++) {
+				tile.load(src, tiles[i], opts.border, borderValue);
+				kernel(std::as_const(tile), dst);
+			}
+		}
+
+		/// Convert a result of a computation in double precision to the image data type, rounding and clamping for integer types
+		template<typename U>
+		U castPixel(double v) {
+			if constexpr (std::is_integral_v<U>) {
+				return static_cast<U>(std::clamp(std::round(v), static_cast<double>((std::numeric_limits<U>::min)()),
+												 static_cast<double>((std::numeric_limits<U>::max)())));
+			} else {
+				return static_cast<U>(v);
+			}
+		}
+	}  // namespace Detail
+	/// @endcond
+
+	/**
+	 * @brief   Call a kernel for every tile of the source image, sequentially
+	 * @param   src - source image, e.g. Image<T> or ImageTypedView<T>
+	 * @param   dst - destination image with the same number of slices, rows and columns, may have a different type and number of channels
+	 * @param   opts - tiling options
+	 * @param   kernel - callable taking (const Tile<T>&, const ImageAccessor<U>&), where T and U are data types of \p src and \p dst; it is expected
+	 *          to compute and write the part of \p dst covered by tile.region()
+	 * @throws  ErrorName::ImageSizeError - if dimensions of the images do not match
+	 */
+	template<typename SrcImage, typename DstImage, typename F>
+	void forEachTile(const SrcImage& src, DstImage& dst, const Options& opts, F&& kernel) {
+		using T = typename SrcImage::value_type;
+		using U = typename DstImage::value_type;
+		ImageAccessor<const T> in {src};
+		ImageAccessor<U> out {dst};
+		const auto tiles = makeTiles(Detail::imageExtent(in, out), opts.tileSize);
+		std::atomic<size_t> next {0};
+		Detail::processTiles(in, out, tiles, next, Detail::effectiveHalo(opts.halo, src.is3D()), opts, kernel);
+	}
+
+	/**
+	 * @brief   Call a kernel for every tile of the source image, distributing the tiles dynamically between tasks on a thread pool
+	 * @param   pool - thread pool, for example LLU::ThreadPool or LLU::BasicPool
+	 * @param   src - source image, e.g. Image<T> or ImageTypedView<T>
+	 * @param   dst - destination image with the same number of slices, rows and columns, may have a different type and number of channels
+	 * @param   opts - tiling options
+	 * @param   kernel - callable taking (const Tile<T>&, const ImageAccessor<U>&), it is called concurrently on different tiles
+	 * @param   workers - number of tasks processing tiles, including the calling thread, by default the number of hardware threads
+	 * @throws  ErrorName::ImageSizeError - if dimensions of the images do not match
+	 * @note    The calling thread takes part in the processing and waits for the other tasks, so this function must not be called from a task
+	 *          running on the same pool. If the kernel throws, the remaining tiles are skipped and the first exception is rethrown after all tasks
+	 *          finish.
+	 */
+	template<typename Pool, typename SrcImage, typename DstImage, typename F>
+	void forEachTile(Pool& pool, const SrcImage& src, DstImage& dst, const Options& opts, F&& kernel,
+					 unsigned workers = std::thread::hardware_concurrency()) {
+		using T = typename SrcImage::value_type;
+		using U = typename DstImage::value_type;
+		ImageAccessor<const T> in {src};
+		ImageAccessor<U> out {dst};
+		const auto tiles = makeTiles(Detail::imageExtent(in, out), opts.tileSize);
+		const auto halo = Detail::effectiveHalo(opts.halo, src.is3D());
+		std::atomic<size_t> next {0};
+		const auto taskCount = std::clamp<size_t>(workers, 1, std::max<size_t>(tiles.size(), 1));
+		// when a kernel throws in any task, moving the counter past the last tile lets the other tasks finish early
+		Async::runTasks(
+			pool, taskCount, [&](size_t /*task*/) { Detail::processTiles(in, out, tiles, next, halo, opts, kernel); },
+			[&next, count = tiles.size()] { next = count; });
+	}
+
+	/// @cond
+	namespace Detail {
+		/// Tile kernel computing separable convolution with the same 1D kernel along each spatial axis
+		template<typename T, typename U>
+		auto separableConvolutionKernel(const std::vector<double>& weights, bool is3D) {
+			return [&weights, is3D](const Tile<T>& tile, const ImageAccessor<U>& out) {
+				const auto radius = static_cast<mint>(weights.size() / 2);
+				const auto& halo = tile.halo();
+				const auto& origin = tile.region().origin;
+				const mint slices = tile.slices();
+				const mint rows = tile.rows();
+				const mint cols = tile.columns();
+				const mint paddedSlices = slices + 2 * halo.slices;
+				const mint paddedRows = rows + 2 * halo.rows;
+				// pass along columns covers all padded rows and slices, pass along rows covers padded slices
+				std::vector<double> alongColumns(static_cast<size_t>(paddedSlices * paddedRows * cols));
+				std::vector<double> alongRows(static_cast<size_t>(paddedSlices * rows * cols));
+				std::vector<double> result(static_cast<size_t>(cols));
+				for (mint ch = 0; ch < tile.channels(); ++ch) {
+					std::fill(alongColumns.begin(), alongColumns.end(), 0.);
+					for (mint z = 0; z < paddedSlices; ++z) {
+						for (mint y = 0; y < paddedRows; ++y) {
+							const T* line = tile.line(z - halo.slices, y - halo.rows, ch) - radius;
+							double* acc = alongColumns.data() + (z * paddedRows + y) * cols;
+							for (size_t j = 0; j < weights.size(); ++j) {
+								const double w = weights[j];
+								for (mint x = 0; x < cols; ++x) {
+									acc[x] += w * static_cast<double>(line[x + static_cast<mint>(j)]);
+								}
+							}
+						}
+					}
+					std::fill(alongRows.begin(), alongRows.end(), 0.);
+					for (mint z = 0; z < paddedSlices; ++z) {
+						for (mint y = 0; y < rows; ++y) {
+							double* acc = alongRows.data() + (z * rows + y) * cols;
+							for (size_t j = 0; j < weights.size(); ++j) {
+								const double w = weights[j];
+								const double* in = alongColumns.data() + (z * paddedRows + y + static_cast<mint>(j)) * cols;
+								for (mint x = 0; x < cols; ++x) {
+									acc[x] += w * in[x];
+								}
+							}
+						}
+					}
+					for (mint z = 0; z < slices; ++z) {
+						for (mint y = 0; y < rows; ++y) {
+							const double* values = alongRows.data() + (z * rows + y) * cols;
+							if (is3D) {
+								std::fill(result.begin(), result.end(), 0.);
+								for (size_t j = 0; j < weights.size(); ++j) {
+									const double w = weights[j];
+									const double* in = alongRows.data() + ((z + static_cast<mint>(j)) * rows + y) * cols;
+									for (mint x = 0; x < cols; ++x) {
+										result[static_cast<size_t>(x)] += w * in[x];
+									}
+								}
+								values = result.data();
+							}
+							for (mint x = 0; x < cols; ++x) {
+								out(origin.slices + z, origin.rows + y, origin.columns + x, ch) = castPixel<U>(values[x]);
+							}
+						}
+					}
+				}
+			};
+		}
+
+		/// Check that the convolution writes every channel of the source to an existing channel of the destination
+		template<typename SrcImage, typename DstImage>
+		void checkConvolutionChannels(const SrcImage& src, const DstImage& dst) {
+			if (src.channels() != dst.channels()) {
+				ErrorManager::throwExceptionWithDebugInfo(ErrorName::ImageSizeError, "Convolution requires images with the same number of channels");
+			}
+		}
+
+		/// Check the convolution kernel and create tiling options for it
+		inline Options separableConvolutionOptions(const std::vector<double>& weights, Border border, const Extent& tileSize) {
+			if (weights.size() % 2 == 0) {
+				ErrorManager::throwExceptionWithDebugInfo(ErrorName::DimensionsError, "Convolution kernel must have odd length");
+			}
+			const auto radius = static_cast<mint>(weights.size() / 2);
+			return {tileSize, {radius, radius, radius}, border, 0.};
+		}
+	}  // namespace Detail
+	/// @endcond
+
+	/**
+	 * @brief   Convolve an image with a separable kernel, which is the outer product of \p weights with itself along all spatial axes
+	 * @param   src - source image, e.g. Image<T> or ImageTypedView<T>
+	 * @param   dst - destination image with the same dimensions and number of channels, values are rounded and clamped for integer types
+	 * @param   weights - 1D kernel of odd length, the center element corresponds to the current pixel
+	 * @param   border - border policy, Border::Constant uses value 0
+	 * @param   tileSize - maximal size of a tile
+	 * @throws  ErrorName::DimensionsError - if the length of \p weights is even
+	 * @throws  ErrorName::ImageSizeError - if dimensions or numbers of channels of the images do not match
+	 * @note    The result is the correlation of the image with the kernel, which is the same as convolution for symmetric kernels.
+	 */
+	template<typename SrcImage, typename DstImage>
+	void convolveSeparable(const SrcImage& src, DstImage& dst, const std::vector<double>& weights, Border border = Border::Reflect,
+						   const Extent& tileSize = DefaultTileSize) {
+		using T = typename SrcImage::value_type;
+		using U = typename DstImage::value_type;
+		Detail::checkConvolutionChannels(src, dst);
+		auto opts = Detail::separableConvolutionOptions(weights, border, tileSize);
+		forEachTile(src, dst, opts, Detail::separableConvolutionKernel<T, U>(weights, src.is3D()));
+	}
+
+	/**
+	 * @brief   Convolve an image with a separable kernel, processing tiles in parallel on a thread pool
+	 * @param   pool - thread pool, for example LLU::ThreadPool or LLU::BasicPool
+	 * @param   src - source image, e.g. Image<T> or ImageTypedView<T>
+	 * @param   dst - destination image with the same dimensions and number of channels, values are rounded and clamped for integer types
+	 * @param   weights - 1D kernel of odd length, the center element corresponds to the current pixel
+	 * @param   border - border policy, Border::Constant uses value 0
+	 * @param   tileSize - maximal size of a tile
+	 * @throws  ErrorName::DimensionsError - if the length of \p weights is even
+	 * @throws  ErrorName::ImageSizeError - if dimensions or numbers of channels of the images do not match
+	 */
+	template<typename Pool, typename SrcImage, typename DstImage>
+	void convolveSeparable(Pool& pool, const SrcImage& src, DstImage& dst, const std::vector<double>& weights, Border border = Border::Reflect,
+						   const Extent& tileSize = DefaultTileSize) {
+		using T = typename SrcImage::value_type;
+		using U = typename DstImage::value_type;
+		Detail::checkConvolutionChannels(src, dst);
+		auto opts = Detail::separableConvolutionOptions(weights, border, tileSize);
+		forEachTile(pool, src, dst, opts, Detail::separableConvolutionKernel<T, U>(weights, src.is3D()));
+	}
+
+}  // namespace LLU::Tiling
+
+#endif	  // LLU_CONTAINERS_IMAGETILES_HPP
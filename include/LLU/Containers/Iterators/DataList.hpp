@@ -25,7 +25,10 @@ namespace LLU {
 
 			GenericDataNode node;
 
-			explicit DataListIteratorPrimitive(DataStoreNode n) : node{n} {}
+			/// Whether node types must be checked when nodes are decoded, false only for DataLists whose node types were already validated
+			bool checkTypes = true;
+
+			explicit DataListIteratorPrimitive(DataStoreNode n, bool check = true) : node{n}, checkTypes {check} {}
 
 			explicit DataListIteratorPrimitive(const DataStoreIterator& it) : node{*it} {}
 
@@ -57,7 +60,7 @@ namespace LLU {
 		 * @return proxy object for the currently pointed to node
 		 */
 		reference operator*() const {
-			return reference {node};
+			return reference {node, checkTypes};
 		}
 
 		/**
@@ -74,7 +77,7 @@ namespace LLU {
 		 * @return "old" copy of the iterator object
 		 */
 		NodeIterator operator++(int) {
-			NodeIterator tmp {node};
+			NodeIterator tmp {*this};
 			++(*this);
 			return tmp;
 		}
@@ -157,9 +160,9 @@ namespace LLU {
 		 */
 		reference operator*() const {
 			if constexpr (std::is_same_v<T, Argument::Typed::Any>) {
-				return  node.value();
+				return node.value();
 			} else {
-				return as<T>();
+				return checkTypes ? node.as<T>() : node.asUnchecked<T>();
 			}
 		}
 
@@ -177,7 +180,7 @@ namespace LLU {
 		 * @return "old" copy of the iterator object
 		 */
 		NodeValueIterator operator++(int) {
-			NodeValueIterator tmp {node.node};
+			NodeValueIterator tmp {*this};
 			++(*this);
 			return tmp;
 		}
@@ -189,12 +192,7 @@ namespace LLU {
 		 */
 		template<typename U>
 		U as() const {
-			auto v = node.value();
-			auto* ptr = std::get_if<U>(std::addressof(v));
-			if (!ptr) {
-				ErrorManager::throwException(ErrorName::DLInvalidNodeType);
-			}
-			return std::move(*ptr);
+			return node.as<U>();
 		}
 	};
 
@@ -20,7 +20,6 @@ namespace LLU {
 	 */
 	template<typename T>
 	class DataNode {
-		static constexpr bool isGeneric = std::is_same_v<T, Argument::TypedArgument>;
 		static_assert(Argument::WrapperQ<T>, "DataNode type is not a valid MArgument wrapper type.");
 
 	public:
@@ -33,8 +32,9 @@ namespace LLU {
 		/**
 		 * @brief 	Create DataNode from raw GenericDataNode
 		 * @param 	gn - generic data node
+		 * @param 	checkType - whether to check that the node holds a value of type T, may be false only if the node type is already known
 		 */
-		explicit DataNode(GenericDataNode gn);
+		explicit DataNode(GenericDataNode gn, bool checkType = true);
 
 		/**
 		 * @brief 	Get node value
@@ -110,15 +110,11 @@ namespace LLU {
 	DataNode<T>::DataNode(DataStoreNode dsn) : DataNode(GenericDataNode {dsn}) {}
 
 	template<typename T>
-	DataNode<T>::DataNode(GenericDataNode gn) : node {gn} {
+	DataNode<T>::DataNode(GenericDataNode gn, bool checkType) : node {gn} {
 		if (!node) {
 			ErrorManager::throwException(ErrorName::DLNullRawNode);
 		}
-		if constexpr (isGeneric) {
-			nodeArg = std::move(node.value());
-		} else{
-			nodeArg = std::move(node.as<T>());
-		}
+		nodeArg = checkType ? node.as<T>() : node.asUnchecked<T>();
 	}
 
 
@@ -47,15 +47,39 @@ namespace LLU {
 		 */
 		[[nodiscard]] Argument::TypedArgument value() const;
 
+		/**
+		 * Get raw value of the node, without checking or decoding its type
+		 * @return MArgument holding the value of the node
+		 */
+		[[nodiscard]] MArgument rawValue() const;
+
+		/**
+		 * Get a copy of the node value that can be added to another DataStore or kept after this DataStore is freed
+		 * @return TypedArgument variant holding the copied value, containers are deep-copied and owned by the library
+		 * @note   Strings are not copied, the returned string_view still points to the node. A copied MSparseArray is a raw container, so it must be freed
+		 *         by the caller unless it is passed on to LibraryLink or to a DataStore.
+		 */
+		[[nodiscard]] Argument::TypedArgument valueCopy() const;
+
 		// defined in Containers/Generic/DataStore.hpp because the definition of GenericDataList must be available
 		/**
 		 * Get node value if it is of type T, otherwise throw an exception.
 		 * @tparam T - any type from LLU::NodeType namespace
 		 * @return node value of type T
+		 * @note   The value is decoded directly to T, without constructing a TypedArgument variant (unless T is the variant itself)
 		 */
 		template<typename T>
 		T as() const;
 
+		/**
+		 * Get node value as T, assuming that the node actually holds a value of type T.
+		 * @tparam T - any type from LLU::NodeType namespace
+		 * @return node value of type T
+		 * @warning Calling this function on a node of different type is undefined behavior, use it only after the node type was validated.
+		 */
+		template<typename T>
+		T asUnchecked() const;
+
 		/**
 		 * Bool conversion operator
 		 * @return true iff the node is not null
@@ -0,0 +1,205 @@
+/**
+ * @file	Strided.hpp
+ * @brief   Random access iterator and range over elements placed at constant distance from each other in memory.
+ */
+#ifndef LLU_CONTAINERS_ITERATORS_STRIDED_HPP
+#define LLU_CONTAINERS_ITERATORS_STRIDED_HPP
+
+#include <iterator>
+
+#include "LLU/LibraryData.h"
+
+namespace LLU {
+
+	/**
+	 * @brief   Random access iterator that advances by a fixed number of elements (the stride) at each step.
+	 *
+	 * Used to walk along a row or a channel of an image without computing the full index of every element.
+	 * @tparam  T - type of elements, may be const-qualified
+	 */
+	template<typename T>
+	class StridedIterator {
+	public:
+		/// @cond
+		using iterator_category = std::random_access_iterator_tag;
+		using value_type = std::remove_cv_t<T>;
+		using difference_type = mint;
+		using pointer = T*;
+		using reference = T&;
+		/// @endcond
+
+		StridedIterator() = default;
+
+		/**
+		 * @brief   Create an iterator pointing to \p p that advances by \p s elements
+		 * @param   p - pointer to the current element
+		 * @param   s - distance (in elements) between consecutive elements of the range
+		 */
+		StridedIterator(T* p, mint s) noexcept : ptr {p}, stride {s} {}
+
+		/// Get the element pointed to
+		reference operator*() const noexcept {
+			return *ptr;
+		}
+
+		/// Access members of the element pointed to
+		pointer operator->() const noexcept {
+			return ptr;
+		}
+
+		/// Get the element \p n steps away
+		reference operator[](difference_type n) const noexcept {
+			return ptr[n * stride];
+		}
+
+		/// Pre-increment
+		StridedIterator& operator++() noexcept {
+			ptr += stride;
+			return *this;
+		}
+
+		/// Post-increment
+		StridedIterator operator++(int) noexcept {
+			auto tmp = *this;
+			ptr += stride;
+			return tmp;
+		}
+
+		/// Pre-decrement
+		StridedIterator& operator--() noexcept {
+			ptr -= stride;
+			return *this;
+		}
+
+		/// Post-decrement
+		StridedIterator operator--(int) noexcept {
+			auto tmp = *this;
+			ptr -= stride;
+			return tmp;
+		}
+
+		/// Advance by \p n steps
+		StridedIterator& operator+=(difference_type n) noexcept {
+			ptr += n * stride;
+			return *this;
+		}
+
+		/// Move back by \p n steps
+		StridedIterator& operator-=(difference_type n) noexcept {
+			ptr -= n * stride;
+			return *this;
+		}
+
+		/// Get an iterator \p n steps ahead
+		friend StridedIterator operator+(StridedIterator it, difference_type n) noexcept {
+			return it += n;
+		}
+
+		/// Get an iterator \p n steps ahead
+		friend StridedIterator operator+(difference_type n, StridedIterator it) noexcept {
+			return it += n;
+		}
+
+		/// Get an iterator \p n steps back
+		friend StridedIterator operator-(StridedIterator it, difference_type n) noexcept {
+			return it -= n;
+		}
+
+		/// Get the number of steps between two iterators over the same range
+		friend difference_type operator-(const StridedIterator& lhs, const StridedIterator& rhs) noexcept {
+			return (lhs.ptr - rhs.ptr) / lhs.stride;
+		}
+
+		/// @cond
+		friend bool operator==(const StridedIterator& lhs, const StridedIterator& rhs) noexcept {
+			return lhs.ptr == rhs.ptr;
+		}
+		friend bool operator!=(const StridedIterator& lhs, const StridedIterator& rhs) noexcept {
+			return lhs.ptr != rhs.ptr;
+		}
+		friend bool operator<(const StridedIterator& lhs, const StridedIterator& rhs) noexcept {
+			return (lhs - rhs) < 0;
+		}
+		friend bool operator>(const StridedIterator& lhs, const StridedIterator& rhs) noexcept {
+			return rhs < lhs;
+		}
+		friend bool operator<=(const StridedIterator& lhs, const StridedIterator& rhs) noexcept {
+			return !(rhs < lhs);
+		}
+		friend bool operator>=(const StridedIterator& lhs, const StridedIterator& rhs) noexcept {
+			return !(lhs < rhs);
+		}
+		/// @endcond
+
+	private:
+		T* ptr = nullptr;
+		mint stride = 1;
+	};
+
+	/**
+	 * @brief   Non-owning range of \c count elements of type T placed \c stride elements apart
+	 * @tparam  T - type of elements, may be const-qualified
+	 */
+	template<typename T>
+	class StridedRange {
+	public:
+		/// Type of elements in the range
+		using value_type = std::remove_cv_t<T>;
+
+		/// Iterator type
+		using iterator = StridedIterator<T>;
+
+		StridedRange() = default;
+
+		/**
+		 * @brief   Create a range
+		 * @param   first - pointer to the first element
+		 * @param   count - number of elements
+		 * @param   stride - distance (in elements) between consecutive elements
+		 */
+		StridedRange(T* first, mint count, mint stride) noexcept : first {first}, count {count}, stride {stride} {}
+
+		/// Get iterator to the first element
+		iterator begin() const noexcept {
+			return {first, stride};
+		}
+
+		/// Get iterator past the last element
+		iterator end() const noexcept {
+			return {first + count * stride, stride};
+		}
+
+		/// Get the number of elements
+		mint size() const noexcept {
+			return count;
+		}
+
+		/// Get the distance between consecutive elements
+		mint getStride() const noexcept {
+			return stride;
+		}
+
+		/// Check if elements are adjacent in memory, in which case the range can be processed as a plain array starting at data()
+		bool contiguousQ() const noexcept {
+			return stride == 1;
+		}
+
+		/// Get pointer to the first element
+		T* data() const noexcept {
+			return first;
+		}
+
+		/// Get element at given position in the range
+		T& operator[](mint index) const noexcept {
+			return first[index * stride];
+		}
+
+	private:
+		T* first = nullptr;
+		mint count = 0;
+		mint stride = 1;
+	};
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_ITERATORS_STRIDED_HPP
@@ -0,0 +1,236 @@
+/**
+ * @file	MMapArray.hpp
+ * @brief	Typed view over an array stored in a memory-mapped file.
+ *
+ * MMapArray gives the same interface as other MArrays (iterators, rank, dimensions, multi-index access) to data that lives in a file, so datasets
+ * larger than the available memory can be processed chunk by chunk without reading them into memory first. Only the pages that are actually
+ * accessed are loaded by the operating system, and only the results need to be copied into Kernel containers.
+ *
+ * @code
+ * 	LLU_LIBRARY_FUNCTION(ColumnTotals) {
+ * 		LLU::MMapArray<double> data {mngr.getString(0)};
+ * 		data.advise(LLU::AccessHint::Sequential);
+ * 		LLU::Tensor<double> totals(0., {data.dimension(1)});
+ * 		for (mint row = 0; row < data.dimension(0); ++row) {
+ * 			auto values = data.chunk(row * data.dimension(1), data.dimension(1));
+ * 			std::transform(values.begin(), values.end(), totals.begin(), totals.begin(), std::plus<> {});
+ * 		}
+ * 		mngr.set(totals);
+ * 	}
+ * @endcode
+ */
+#ifndef LLU_CONTAINERS_MMAPARRAY_HPP
+#define LLU_CONTAINERS_MMAPARRAY_HPP
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "LLU/Containers/Iterators/Strided.hpp"
+#include "LLU/Containers/MArray.hpp"
+#include "LLU/Containers/MappedFile.h"
+#include "LLU/Containers/NumericArray.h"
+#include "LLU/ErrorLog/ErrorManager.h"
+
+namespace LLU {
+
+	/**
+	 * @brief   Array of elements of type T backed by a memory-mapped file
+	 *
+	 * The file either starts with an ArrayFileHeader, which stores the type and dimensions of the array, or is a raw sequence of elements
+	 * (possibly after a header of a different format, skipped with the offset parameter). All paths are validated with validatePath.
+	 * In the MMapMode::ReadOnly mode the file is never modified, in the MMapMode::ReadWrite mode all writes to elements go to the file.
+	 *
+	 * @tparam  T - type of elements, any type supported by NumericArray
+	 * @note    Data is stored in the native byte order.
+	 */
+	template<typename T>
+	class MMapArray : public MArray<T> {
+	public:
+		/// Range of elements which lie at a constant distance from each other in the file
+		using range_type = StridedRange<T>;
+
+		MMapArray() = default;
+
+		/**
+		 * @brief   Map a file which starts with an ArrayFileHeader
+		 * @param   fileName - path to the file
+		 * @param   mode - access mode
+		 * @throws  ErrorName::InvalidArrayFileHeader - if the header is not valid
+		 * @throws  ErrorName::NumericArrayTypeError - if the type stored in the header is not T
+		 * @throws  see MappedFile::MappedFile(const std::string&, MMapMode)
+		 */
+		explicit MMapArray(const std::string& fileName, MMapMode mode = MMapMode::ReadOnly) : MMapArray(mapWithHeader(fileName, mode)) {}
+
+		/**
+		 * @brief   Map a raw file with elements of an array of given dimensions
+		 * @param   fileName - path to the file
+		 * @param   dims - dimensions of the array
+		 * @param   mode - access mode
+		 * @param   offset - number of bytes to skip at the beginning of the file, must be a multiple of the alignment of T
+		 * @throws  ErrorName::DimensionsError - if the file is too short or the offset is misaligned
+		 */
+		MMapArray(const std::string& fileName, MArrayDimensions dims, MMapMode mode = MMapMode::ReadOnly, std::size_t offset = 0)
+			: MMapArray(mapRaw(fileName, std::move(dims), mode, offset)) {}
+
+		/**
+		 * @brief   Map a raw file as a flat array of all elements that fit in it after \p offset
+		 * @param   fileName - path to the file
+		 * @param   mode - access mode
+		 * @param   offset - number of bytes to skip at the beginning of the file, must be a multiple of the alignment of T
+		 * @return  rank 1 MMapArray
+		 */
+		static MMapArray raw(const std::string& fileName, MMapMode mode = MMapMode::ReadOnly, std::size_t offset = 0) {
+			return MMapArray {mapRaw(fileName, {}, mode, offset)};
+		}
+
+		/**
+		 * @brief   Create a new file with an ArrayFileHeader and space for an array of given dimensions, filled with zeros
+		 * @param   fileName - path to the file, an existing file is overwritten
+		 * @param   dims - dimensions of the array
+		 * @return  MMapArray in the MMapMode::ReadWrite mode
+		 */
+		static MMapArray create(const std::string& fileName, MArrayDimensions dims) {
+			const std::size_t offset = ArrayFileHeader::sizeForRank(dims.rank());
+			MappedFile file = MappedFile::create(fileName, offset + static_cast<std::size_t>(dims.flatCount()) * sizeof(T));
+			ArrayFileHeader header {NumericArrayType<T>, dims, offset};
+			header.write(file);
+			return MMapArray {Mapping {std::move(file), std::move(dims), offset}};
+		}
+
+		/// Get the access mode
+		[[nodiscard]] MMapMode mode() const noexcept {
+			return file.mode();
+		}
+
+		/// Get the path of the mapped file
+		[[nodiscard]] const std::string& fileName() const noexcept {
+			return file.fileName();
+		}
+
+		/**
+		 * @brief   Tell the operating system how the whole array is going to be accessed
+		 * @param   hint - access pattern, e.g. AccessHint::Sequential for streaming over the array or AccessHint::Random for lookups
+		 */
+		void advise(AccessHint hint) const noexcept {
+			advise(hint, 0, this->size());
+		}
+
+		/**
+		 * @brief   Tell the operating system how a range of elements is going to be accessed
+		 * @param   hint - access pattern, e.g. AccessHint::WillNeed for a chunk which will be processed next
+		 * @param   first - index of the first element of the range
+		 * @param   count - number of elements
+		 */
+		void advise(AccessHint hint, mint first, mint count) const noexcept {
+			file.advise(hint, dataOffset + static_cast<std::size_t>(first) * sizeof(T), static_cast<std::size_t>(count) * sizeof(T));
+		}
+
+		/**
+		 * @brief   Make sure all modifications are written to the file. Does nothing in the MMapMode::ReadOnly mode.
+		 * @throws  ErrorName::MapFileFailed - if the data could not be written
+		 */
+		void flush() const {
+			file.flush();
+		}
+
+		/**
+		 * @brief   Get a contiguous range of elements, in flat (row-major) order
+		 * @param   first - index of the first element
+		 * @param   count - number of elements
+		 * @return  zero-copy view over the elements
+		 * @throws  ErrorName::MArrayElementIndexError - if the range does not fit in the array
+		 */
+		range_type chunk(mint first, mint count) const {
+			if (first < 0 || count < 0 || first > this->size() - count) {
+				ErrorManager::throwException(ErrorName::MArrayElementIndexError, first);
+			}
+			return {getData() + first, count, 1};
+		}
+
+		/**
+		 * @brief   Get all elements along one dimension, with indices in the other dimensions fixed, e.g. a column of a matrix
+		 * @param   level - the dimension along which the range goes
+		 * @param   position - full multi-index of an element of the range, its value at \p level is ignored
+		 * @return  zero-copy view over dimension(level) elements
+		 * @throws  ErrorName::MArrayDimensionIndexError - if \p level is not a valid dimension index
+		 * @throws  ErrorName::MArrayElementIndexError - if \p position is not a valid multi-index
+		 */
+		range_type lane(mint level, std::vector<mint> position) const {
+			const mint count = this->dimension(level);
+			if (static_cast<mint>(position.size()) != this->rank()) {
+				ErrorManager::throwException(ErrorName::MArrayElementIndexError, static_cast<mint>(position.size()));
+			}
+			position[static_cast<std::size_t>(level)] = 0;
+			mint stride = 1;
+			for (mint d = level + 1; d < this->rank(); ++d) {
+				stride *= this->dimension(d);
+			}
+			return {getData() + this->dimensions().getIndexChecked(position), count, stride};
+		}
+
+		/**
+		 * @brief   Copy a range of elements into a new flat NumericArray
+		 * @param   first - index of the first element
+		 * @param   count - number of elements
+		 * @return  NumericArray owned by the library
+		 */
+		NumericArray<T> toNumericArray(mint first, mint count) const {
+			auto elements = chunk(first, count);
+			return NumericArray<T> {elements.data(), elements.data() + count, {count}};
+		}
+
+		/**
+		 * @brief   Copy the whole array into a new NumericArray of the same dimensions
+		 * @return  NumericArray owned by the library
+		 */
+		NumericArray<T> toNumericArray() const {
+			return {this->cbegin(), this->cend(), this->dimensions()};
+		}
+
+	private:
+		/// Mapped file together with the location and shape of the array inside it
+		struct Mapping {
+			MappedFile file;
+			MArrayDimensions dims;
+			std::size_t offset;
+		};
+
+		explicit MMapArray(Mapping m) : MArray<T>(std::move(m.dims)), file {std::move(m.file)}, dataOffset {m.offset} {}
+
+		static Mapping mapWithHeader(const std::string& fileName, MMapMode mode) {
+			MappedFile f {fileName, mode};
+			auto header = ArrayFileHeader::read(f);
+			if (header.type != NumericArrayType<T>) {
+				ErrorManager::throwException(ErrorName::NumericArrayTypeError);
+			}
+			return {std::move(f), std::move(header.dims), header.dataOffset};
+		}
+
+		static Mapping mapRaw(const std::string& fileName, MArrayDimensions dims, MMapMode mode, std::size_t offset) {
+			MappedFile f {fileName, mode};
+			if (offset % alignof(T) != 0 || offset > f.size()) {
+				ErrorManager::throwExceptionWithDebugInfo(ErrorName::DimensionsError, "Invalid offset of array data in file " + fileName);
+			}
+			const std::size_t available = (f.size() - offset) / sizeof(T);
+			if (dims.rank() == 0) {
+				dims = MArrayDimensions {static_cast<mint>(available)};
+			} else if (static_cast<std::size_t>(dims.flatCount()) > available) {
+				ErrorManager::throwExceptionWithDebugInfo(ErrorName::DimensionsError, "File " + fileName + " is too short for given dimensions");
+			}
+			return {std::move(f), std::move(dims), offset};
+		}
+
+		T* getData() const noexcept override {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): the offset is aligned and the mapping is page-aligned
+			return file.data() ? reinterpret_cast<T*>(file.data() + dataOffset) : nullptr;
+		}
+
+		MappedFile file;
+		std::size_t dataOffset = 0;
+	};
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_MMAPARRAY_HPP
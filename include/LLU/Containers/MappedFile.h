@@ -0,0 +1,164 @@
+/**
+ * @file	MappedFile.h
+ * @brief	Memory mapping of files and the header format of array files used by MMapArray.
+ */
+#ifndef LLU_CONTAINERS_MAPPEDFILE_H
+#define LLU_CONTAINERS_MAPPEDFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "LLU/Containers/MArrayDimensions.h"
+#include "LLU/LibraryData.h"
+
+namespace LLU {
+
+	/// Access mode of a memory-mapped file
+	enum struct MMapMode : uint8_t {
+		ReadOnly,	 ///< The file is never modified. Writes to the mapped memory are allowed, but they are private to the process.
+		ReadWrite	 ///< Writes to the mapped memory are carried through to the file.
+	};
+
+	/// Expected access pattern of mapped memory, passed to the operating system as a hint
+	enum struct AccessHint : uint8_t {
+		Normal,		   ///< No special treatment
+		Sequential,	   ///< Memory will be accessed in order, aggressive read-ahead is useful and pages can be dropped soon after they are read
+		Random,		   ///< Memory will be accessed in random order, read-ahead is wasteful
+		WillNeed,	   ///< Memory will be accessed soon, it is worth to start reading it in the background
+		DontNeed	   ///< Memory will not be accessed in the near future, resources associated with it can be freed
+	};
+
+	/**
+	 * @brief   Owning handle to a file mapped into memory
+	 *
+	 * The file is opened after its path is validated with validatePath, mapped in whole and closed immediately, the mapping stays valid until
+	 * the MappedFile is destroyed.
+	 */
+	class MappedFile {
+	public:
+		/// Create an empty handle
+		MappedFile() = default;
+
+		/**
+		 * @brief   Map an existing file into memory
+		 * @param   fileName - path to the file
+		 * @param   mode - access mode
+		 * @throws  ErrorName::PathNotValidated - if the path cannot be validated under the desired mode
+		 * @throws  ErrorName::OpenFileFailed - if the file could not be opened
+		 * @throws  ErrorName::MapFileFailed - if the file could not be mapped into memory
+		 */
+		MappedFile(const std::string& fileName, MMapMode mode);
+
+		/**
+		 * @brief   Create a new file of given size (or truncate an existing one) and map it into memory for reading and writing
+		 * @param   fileName - path to the file
+		 * @param   size - size of the file in bytes, contents of the file are initially zero
+		 * @return  MappedFile in the ReadWrite mode
+		 * @throws  see MappedFile::MappedFile(const std::string&, MMapMode)
+		 */
+		static MappedFile create(const std::string& fileName, std::size_t size);
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		/// Move-constructor takes over the mapping
+		MappedFile(MappedFile&& other) noexcept;
+
+		/// Move-assignment operator unmaps the current file and takes over the mapping of \p other
+		MappedFile& operator=(MappedFile&& other) noexcept;
+
+		/// Unmap the file
+		~MappedFile();
+
+		/// Get pointer to the first byte of the mapped file
+		[[nodiscard]] std::byte* data() const noexcept {
+			return memory;
+		}
+
+		/// Get the size of the mapped file in bytes
+		[[nodiscard]] std::size_t size() const noexcept {
+			return length;
+		}
+
+		/// Get the access mode
+		[[nodiscard]] MMapMode mode() const noexcept {
+			return accessMode;
+		}
+
+		/// Get the path of the mapped file
+		[[nodiscard]] const std::string& fileName() const noexcept {
+			return name;
+		}
+
+		/**
+		 * @brief   Pass an access pattern hint for a range of the mapped memory to the operating system
+		 * @param   hint - expected access pattern
+		 * @param   offset - offset (in bytes) of the first byte of the range, it is rounded down to a page boundary
+		 * @param   count - length of the range in bytes
+		 * @note    Hints are advisory, failures are ignored. On Windows only AccessHint::WillNeed has an effect.
+		 */
+		void advise(AccessHint hint, std::size_t offset, std::size_t count) const noexcept;
+
+		/**
+		 * @brief   Write modified pages back to the file and wait until it is done
+		 * @throws  ErrorName::MapFileFailed - if the data could not be written
+		 */
+		void flush() const;
+
+	private:
+		MappedFile(const std::string& fileName, MMapMode mode, bool createQ, std::size_t size);
+
+		void unmap() noexcept;
+
+		std::byte* memory = nullptr;
+		std::size_t length = 0;
+		MMapMode accessMode = MMapMode::ReadOnly;
+		std::string name;
+	};
+
+	/**
+	 * @brief   Header of an array file: data type and dimensions, followed by the elements in row-major order.
+	 *
+	 * The header consists of the magic bytes "LLUA", a version byte, a reserved byte, a 16-bit numericarray_data_t type code, a 64-bit rank and
+	 * rank 64-bit dimensions. All numbers are stored in the native byte order. Data starts at the first offset after the header which is a multiple
+	 * of ArrayFileHeader::Alignment.
+	 */
+	struct ArrayFileHeader {
+		/// Alignment (in bytes) of the data section within the file
+		static constexpr std::size_t Alignment = 64;
+
+		/// Type of elements
+		numericarray_data_t type;
+
+		/// Dimensions of the array
+		MArrayDimensions dims;
+
+		/// Offset of the first element from the beginning of the file, in bytes
+		std::size_t dataOffset;
+
+		/**
+		 * @brief   Read the header from the beginning of a mapped file
+		 * @param   file - mapped file
+		 * @return  parsed header
+		 * @throws  ErrorName::InvalidArrayFileHeader - if the file does not start with a valid header or is shorter than the header declares
+		 */
+		static ArrayFileHeader read(const MappedFile& file);
+
+		/**
+		 * @brief   Get the size of the header (including padding) for an array of given rank
+		 * @param   rank - rank of the array
+		 * @return  offset of the data section in bytes
+		 */
+		static std::size_t sizeForRank(mint rank) noexcept;
+
+		/**
+		 * @brief   Write the header to the beginning of a mapped file
+		 * @param   file - mapped file at least sizeForRank(dims.rank()) bytes long
+		 */
+		void write(const MappedFile& file) const;
+	};
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_MAPPEDFILE_H
@@ -0,0 +1,174 @@
+/**
+ * @file	NodePayloads.hpp
+ * @brief	Parallel processing of DataList node values.
+ *
+ * The DataStore API is not thread-safe, so DataList nodes can only be traversed by one thread. NodePayloads makes this traversal once, storing names
+ * and values of all nodes (or lightweight views of them, like NumericArrayTypedView, TensorTypedView or std::string_view) in vectors. The stored values
+ * can then be processed by user functions in parallel on a thread pool and the results are gathered in the original order of nodes.
+ */
+#ifndef LLU_CONTAINERS_NODEPAYLOADS_HPP
+#define LLU_CONTAINERS_NODEPAYLOADS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "LLU/Async/Utilities.h"
+#include "LLU/Containers/DataList.h"
+
+namespace LLU {
+
+	/**
+	 * @class   NodePayloads
+	 * @brief   Names and values of all nodes of a DataList, collected in a single pass to be processed in parallel.
+	 * @tparam  View - type in which node values are stored, it must be constructible from the node value type, e.g. NumericArrayTypedView<double>
+	 *          for nodes of type NodeType::NumericArray or TensorTypedView<mint> for NodeType::Tensor. The node value type itself can be used only
+	 *          for scalar and string nodes (e.g. mint, double or std::string_view), because containers cannot be copied and must be stored as views.
+	 * @note    Views and string_views refer to the data owned by the DataList, so NodePayloads must not outlive the DataList it was created from.
+	 */
+	template<typename View>
+	class NodePayloads {
+	public:
+		/**
+		 * @brief   Collect names and values of all nodes of a DataList
+		 * @tparam  T - type of DataList nodes
+		 * @param   list - a DataList, nodes of type NodeType::Any are not supported because their values cannot be converted to a single View type
+		 * @throws  ErrorName::NumericArrayTypeError, ErrorName::TensorTypeError - if a typed view does not match the type of the array in some node
+		 */
+		template<typename T>
+		explicit NodePayloads(const DataList<T>& list);
+
+		/// Get the number of nodes
+		[[nodiscard]] mint size() const noexcept {
+			return static_cast<mint>(payloads.size());
+		}
+
+		/**
+		 * @brief   Get the stored value of the node at given position
+		 * @param   position - index of a node, must be smaller than size()
+		 */
+		const View& operator[](mint position) const noexcept {
+			return payloads[static_cast<std::size_t>(position)];
+		}
+
+		/**
+		 * @brief   Get the name of the node at given position
+		 * @param   position - index of a node, must be smaller than size()
+		 */
+		std::string_view name(mint position) const noexcept {
+			return names[static_cast<std::size_t>(position)];
+		}
+
+		/**
+		 * @brief   Call a function on every stored node value, distributing the nodes dynamically between tasks on a thread pool
+		 * @param   pool - thread pool, for example LLU::ThreadPool or LLU::BasicPool
+		 * @param   f - callable taking const View&, it is called concurrently on different nodes and must not use the DataStore API
+		 *          nor create new LibraryLink containers
+		 * @param   workers - number of tasks, including the calling thread, by default the number of hardware threads
+		 * @return  std::vector of results of \p f in the order of nodes, or nothing if \p f returns void
+		 * @note    The calling thread takes part in the processing and waits for the other tasks, so this function must not be called from a task
+		 *          running on the same pool. If \p f throws, the first exception is rethrown after all tasks finish.
+		 */
+		template<typename Pool, typename F>
+		auto transform(Pool& pool, F&& f, unsigned workers = std::thread::hardware_concurrency()) const;
+
+		/**
+		 * @brief   Call a function on every stored node value in parallel and gather the results into a new DataList with the same node names
+		 * @tparam  U - type of nodes of the new DataList, results of \p f must be convertible to it (e.g. std::string to std::string_view)
+		 * @param   pool - thread pool, for example LLU::ThreadPool or LLU::BasicPool
+		 * @param   f - callable taking const View&, it is called concurrently on different nodes and must not use the DataStore API
+		 *          nor create new LibraryLink containers
+		 * @param   workers - number of tasks, including the calling thread, by default the number of hardware threads
+		 * @return  new DataList, filled by the calling thread after all results are ready
+		 */
+		template<typename U, typename Pool, typename F>
+		DataList<U> transformToDataList(Pool& pool, F&& f, unsigned workers = std::thread::hardware_concurrency()) const;
+
+	private:
+		/// Call \p f on every index in [0, size()), in chunks handed out dynamically to \p workers tasks
+		template<typename Pool, typename F>
+		void forEachIndex(Pool& pool, unsigned workers, F&& f) const;
+
+		/// Node names, they point to strings owned by the DataStore
+		std::vector<std::string_view> names;
+
+		/// Node values converted to View
+		std::vector<View> payloads;
+	};
+
+	template<typename View>
+	template<typename T>
+	NodePayloads<View>::NodePayloads(const DataList<T>& list) {
+		static_assert(!std::is_same_v<T, NodeType::Any>, "NodePayloads cannot be created from a DataList of heterogeneous nodes.");
+		static_assert(std::is_constructible_v<View, const T&>, "NodePayloads view type cannot be created from the DataList node type.");
+		const auto count = static_cast<std::size_t>(list.length());
+		names.reserve(count);
+		payloads.reserve(count);
+		for (auto node : list) {
+			names.push_back(node.name());
+			payloads.emplace_back(node.value());
+		}
+	}
+
+	template<typename View>
+	template<typename Pool, typename F>
+	void NodePayloads<View>::forEachIndex(Pool& pool, unsigned workers, F&& f) const {
+		const std::size_t count = payloads.size();
+		const auto taskCount = std::clamp<std::size_t>(workers, 1, std::max<std::size_t>(count, 1));
+		// several chunks per task balance the load when node values differ in size, e.g. arrays of different lengths
+		const std::size_t chunk = std::max<std::size_t>(count / (taskCount * 16), 1);
+		std::atomic<std::size_t> next {0};
+		auto work = [&](std::size_t /*task*/) {
+			for (std::size_t first = next.fetch_add(chunk); first < count; first = next.fetch_add(chunk)) {
+				const std::size_t last = std::min(first + chunk, count);
+				for (std::size_t i = first; i < last; ++i) {
+					f(i);
+				}
+			}
+		};
+		// when f throws, moving the counter past the end lets the other tasks finish early
+		Async::runTasks(pool, taskCount, work, [&next, count] { next = count; });
+	}
+
+	template<typename View>
+	template<typename Pool, typename F>
+	auto NodePayloads<View>::transform(Pool& pool, F&& f, unsigned workers) const {
+		using Result = std::invoke_result_t<F&, const View&>;
+		if constexpr (std::is_void_v<Result>) {
+			forEachIndex(pool, workers, [&](std::size_t i) { f(payloads[i]); });
+		} else {
+			// results are constructed in place by the tasks, so Result does not need to be default-constructible
+			std::vector<std::optional<Result>> slots(payloads.size());
+			forEachIndex(pool, workers, [&](std::size_t i) { slots[i].emplace(f(payloads[i])); });
+			std::vector<Result> results;
+			results.reserve(slots.size());
+			for (auto& slot : slots) {
+				results.push_back(std::move(*slot));
+			}
+			return results;
+		}
+	}
+
+	template<typename View>
+	template<typename U, typename Pool, typename F>
+	DataList<U> NodePayloads<View>::transformToDataList(Pool& pool, F&& f, unsigned workers) const {
+		auto results = transform(pool, std::forward<F>(f), workers);
+		DataList<U> res;
+		for (std::size_t i = 0; i < results.size(); ++i) {
+			if (names[i].empty()) {
+				res.push_back(static_cast<U>(std::move(results[i])));
+			} else {
+				res.push_back(names[i], static_cast<U>(std::move(results[i])));
+			}
+		}
+		return res;
+	}
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_NODEPAYLOADS_HPP
@@ -0,0 +1,296 @@
+/**
+ * @file	NumericArrayBatch.hpp
+ * @brief	Many small arrays of the same type stored in a single NumericArray.
+ *
+ * Returning thousands of small arrays, e.g. one feature vector per segment of a signal, as separate NumericArrays costs one Kernel allocation
+ * (and one MArrayDimensions object) per array. NumericArrayBatch computes the layout of all items first, allocates a single backing NumericArray
+ * and gives access to every item through a lightweight view. The result can be returned either in the compact form of values and offsets,
+ * which the Wolfram Language code can split only when (and if) individual items are needed, or as a DataList of separate NumericArrays.
+ */
+#ifndef LLU_CONTAINERS_NUMERICARRAYBATCH_HPP
+#define LLU_CONTAINERS_NUMERICARRAYBATCH_HPP
+
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "LLU/Containers/DataList.h"
+#include "LLU/Containers/Iterators/IterableContainer.hpp"
+#include "LLU/Containers/MArrayDimensions.h"
+#include "LLU/Containers/NumericArray.h"
+#include "LLU/ErrorLog/ErrorManager.h"
+
+namespace LLU {
+
+	/**
+	 * @brief   Shapes of items in a NumericArrayBatch, stored in a few flat vectors regardless of the number of items
+	 */
+	class BatchLayout {
+	public:
+		BatchLayout() = default;
+
+		/**
+		 * @brief   Reserve memory for shapes of items
+		 * @param   items - expected number of items
+		 * @param   totalRank - expected sum of ranks of all items
+		 */
+		void reserve(mint items, mint totalRank) {
+			offsets.reserve(static_cast<std::size_t>(items) + 1);
+			dimOffsets.reserve(static_cast<std::size_t>(items) + 1);
+			dims.reserve(static_cast<std::size_t>(totalRank));
+		}
+
+		/**
+		 * @brief   Append an item of rank 1
+		 * @param   length - number of elements of the item
+		 * @return  index of the new item
+		 */
+		mint addVector(mint length) {
+			return addItem({length});
+		}
+
+		/**
+		 * @brief   Append an item with given dimensions
+		 * @param   dimensions - dimensions of the new item, all must be non-negative
+		 * @return  index of the new item
+		 */
+		mint addItem(std::initializer_list<mint> dimensions) {
+			return addItem(dimensions.begin(), dimensions.end());
+		}
+
+		/**
+		 * @brief   Append an item with dimensions given by a range
+		 * @param   first - iterator to the first dimension
+		 * @param   last - iterator past the last dimension
+		 * @return  index of the new item
+		 * @throws  ErrorName::DimensionsError - if the range is empty or any of the dimensions is negative
+		 */
+		template<typename InputIt>
+		mint addItem(InputIt first, InputIt last) {
+			mint length = 1;
+			const auto rankBefore = dims.size();
+			for (; first != last; ++first) {
+				const auto d = static_cast<mint>(*first);
+				if (d < 0) {
+					dims.resize(rankBefore);
+					ErrorManager::throwExceptionWithDebugInfo(ErrorName::DimensionsError, "Negative dimension of a batch item");
+				}
+				dims.push_back(d);
+				length *= d;
+			}
+			if (dims.size() == rankBefore) {
+				ErrorManager::throwExceptionWithDebugInfo(ErrorName::DimensionsError, "Batch items must have rank at least 1");
+			}
+			offsets.push_back(offsets.back() + length);
+			dimOffsets.push_back(static_cast<mint>(dims.size()));
+			return itemCount() - 1;
+		}
+
+		/// Get the number of items
+		[[nodiscard]] mint itemCount() const noexcept {
+			return static_cast<mint>(offsets.size()) - 1;
+		}
+
+		/// Get the total number of elements of all items
+		[[nodiscard]] mint elementCount() const noexcept {
+			return offsets.back();
+		}
+
+		/// Get the position of the first element of item \p index in the backing array
+		[[nodiscard]] mint offset(mint index) const {
+			return offsets[checkedIndex(index)];
+		}
+
+		/// Get the number of elements of item \p index
+		[[nodiscard]] mint length(mint index) const {
+			const auto i = checkedIndex(index);
+			return offsets[i + 1] - offsets[i];
+		}
+
+		/// Get the rank of item \p index
+		[[nodiscard]] mint rank(mint index) const {
+			const auto i = checkedIndex(index);
+			return dimOffsets[i + 1] - dimOffsets[i];
+		}
+
+		/// Get a pointer to dimensions of item \p index
+		[[nodiscard]] const mint* dimensions(mint index) const {
+			return dims.data() + dimOffsets[checkedIndex(index)];
+		}
+
+		/// Get offsets of all items, with the total number of elements appended
+		[[nodiscard]] const std::vector<mint>& itemOffsets() const noexcept {
+			return offsets;
+		}
+
+	private:
+		std::size_t checkedIndex(mint index) const {
+			if (index < 0 || index >= itemCount()) {
+				ErrorManager::throwException(ErrorName::MArrayElementIndexError, index);
+			}
+			return static_cast<std::size_t>(index);
+		}
+
+		/// Offsets of items in the backing array, the last element is the total number of elements
+		std::vector<mint> offsets {0};
+
+		/// Dimensions of all items, concatenated
+		std::vector<mint> dims;
+
+		/// Offsets of dimensions of items in \c dims
+		std::vector<mint> dimOffsets {0};
+	};
+
+	/**
+	 * @brief   View over a single item of a NumericArrayBatch
+	 * @tparam  T - type of elements
+	 */
+	template<typename T>
+	class BatchItem : public IterableContainer<T> {
+	public:
+		/**
+		 * @brief   Create a view over \p length elements starting at \p data
+		 * @param   data - pointer to the first element
+		 * @param   length - number of elements
+		 * @param   rank - rank of the item
+		 * @param   dims - pointer to \p rank dimensions
+		 */
+		BatchItem(T* data, mint length, mint rank, const mint* dims) : buffer {data}, len {length}, itemRank {rank}, itemDims {dims} {}
+
+		/// Get the rank of the item
+		[[nodiscard]] mint rank() const noexcept {
+			return itemRank;
+		}
+
+		/// Get pointer to dimensions of the item
+		[[nodiscard]] const mint* getDimensions() const noexcept {
+			return itemDims;
+		}
+
+		/// Get dimension \p index of the item
+		[[nodiscard]] mint dimension(mint index) const {
+			if (index < 0 || index >= itemRank) {
+				ErrorManager::throwException(ErrorName::MArrayDimensionIndexError, index);
+			}
+			return itemDims[index];
+		}
+
+	private:
+		T* getData() const noexcept override {
+			return buffer;
+		}
+
+		mint getSize() const noexcept override {
+			return len;
+		}
+
+		T* buffer;
+		mint len;
+		mint itemRank;
+		const mint* itemDims;
+	};
+
+	/**
+	 * @brief   Collection of arrays of different shapes stored one after another in a single flat NumericArray
+	 * @tparam  T - type of elements, any type supported by NumericArray
+	 */
+	template<typename T>
+	class NumericArrayBatch {
+	public:
+		/**
+		 * @brief   Allocate the backing NumericArray for items described by \p layout, elements are initialized with \p init
+		 * @param   layout - shapes of all items
+		 * @param   init - initial value of elements
+		 */
+		explicit NumericArrayBatch(BatchLayout layout, T init = T {})
+			: itemLayout {std::move(layout)}, data {init, MArrayDimensions {itemLayout.elementCount()}} {}
+
+		/**
+		 * @brief   Create a batch of rank 1 items of given lengths
+		 * @param   lengths - lengths of items
+		 * @param   init - initial value of elements
+		 */
+		template<typename Container, typename = std::enable_if_t<std::conjunction_v<std::is_class<Container>, is_iterable<Container>>>>
+		explicit NumericArrayBatch(const Container& lengths, T init = T {}) : NumericArrayBatch(layoutOfVectors(lengths), init) {}
+
+		/// Get the number of items
+		[[nodiscard]] mint size() const noexcept {
+			return itemLayout.itemCount();
+		}
+
+		/**
+		 * @brief   Get a view over the item at given position
+		 * @param   index - position of the item
+		 * @return  view over the item, valid as long as the batch is alive
+		 */
+		BatchItem<T> operator[](mint index) {
+			return {data.data() + itemLayout.offset(index), itemLayout.length(index), itemLayout.rank(index), itemLayout.dimensions(index)};
+		}
+
+		/**
+		 * @brief   Get a read-only view over the item at given position
+		 * @param   index - position of the item
+		 * @return  view over the item, valid as long as the batch is alive
+		 */
+		BatchItem<const T> operator[](mint index) const {
+			return {data.data() + itemLayout.offset(index), itemLayout.length(index), itemLayout.rank(index), itemLayout.dimensions(index)};
+		}
+
+		/// Get the layout of the batch
+		[[nodiscard]] const BatchLayout& layout() const noexcept {
+			return itemLayout;
+		}
+
+		/// Get the backing NumericArray with elements of all items
+		NumericArray<T>& values() noexcept {
+			return data;
+		}
+
+		/// Get the backing NumericArray with elements of all items
+		const NumericArray<T>& values() const noexcept {
+			return data;
+		}
+
+		/**
+		 * @brief   Create a NumericArray with positions of items in values(), with the total number of elements appended
+		 * @return  NumericArray of length size() + 1, item \c i spans elements in range [offsets[i], offsets[i + 1])
+		 */
+		[[nodiscard]] NumericArray<mint> offsets() const {
+			return NumericArray<mint> {itemLayout.itemOffsets()};
+		}
+
+		/**
+		 * @brief   Copy every item into a separate NumericArray of proper dimensions
+		 * @return  DataList with one node per item
+		 * @note    This allocates a NumericArray per item, prefer returning values() and offsets() when the caller can work with them directly.
+		 */
+		[[nodiscard]] DataList<NodeType::NumericArray> toDataList() const {
+			DataList<NodeType::NumericArray> res;
+			for (mint i = 0; i < size(); ++i) {
+				auto item = (*this)[i];
+				res.push_back(NumericArray<T> {item.begin(), item.end(), MArrayDimensions {item.getDimensions(), item.rank()}});
+			}
+			return res;
+		}
+
+	private:
+		template<typename Container>
+		static BatchLayout layoutOfVectors(const Container& lengths) {
+			BatchLayout res;
+			const auto count = static_cast<mint>(std::distance(std::begin(lengths), std::end(lengths)));
+			res.reserve(count, count);
+			for (const auto& length : lengths) {
+				res.addVector(static_cast<mint>(length));
+			}
+			return res;
+		}
+
+		BatchLayout itemLayout;
+		NumericArray<T> data;
+	};
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_NUMERICARRAYBATCH_HPP
@@ -0,0 +1,231 @@
+/**
+ * @file	PackedStrings.hpp
+ * @brief	List of strings stored in two flat NumericArrays: UTF-8 bytes of all strings and offsets where the strings start.
+ *
+ * Every UTF8String node of a DataList is a separate string copied by the DataStore, and reading the nodes back takes a few LibraryLink calls per node.
+ * PackedStrings keeps any number of strings in just two NumericArrays, with the layout of RaggedArray<std::uint8_t>, and gives std::string_view access
+ * to the strings without copying them. In the Wolfram Language, strings are packed with LLU`ToPackedStrings and unpacked with LLU`PackedStringsToList,
+ * and library functions can declare "PackedStrings" as an argument or return type to have it done automatically.
+ */
+#ifndef LLU_CONTAINERS_PACKEDSTRINGS_HPP
+#define LLU_CONTAINERS_PACKEDSTRINGS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include "LLU/Containers/DataList.h"
+#include "LLU/Containers/NumericArray.h"
+#include "LLU/Containers/RaggedArray.hpp"
+#include "LLU/ErrorLog/ErrorManager.h"
+#include "LLU/MArgumentManager.h"
+
+namespace LLU {
+
+	/**
+	 * @class   PackedStrings
+	 * @brief   Immutable list of strings backed by a NumericArray of UTF-8 bytes and a NumericArray of offsets
+	 *
+	 * String \c i consists of bytes at positions [offsets[i], offsets[i + 1]), so there is one offset more than there are strings.
+	 */
+	class PackedStrings {
+	public:
+		/// Iterator over strings, dereferences to std::string_view
+		class iterator {
+		public:
+			/// @cond
+			using iterator_category = std::input_iterator_tag;
+			using value_type = std::string_view;
+			using difference_type = mint;
+			using pointer = void;
+			using reference = std::string_view;
+			/// @endcond
+
+			/// Create an iterator pointing to the string at given position in \p ps
+			iterator(const PackedStrings* ps, mint index) noexcept : strings {ps}, pos {index} {}
+
+			/// Get the current string
+			std::string_view operator*() const noexcept {
+				return (*strings)[pos];
+			}
+
+			/// Move to the next string
+			iterator& operator++() noexcept {
+				++pos;
+				return *this;
+			}
+
+			/// Move to the next string, return the iterator to the previous one
+			iterator operator++(int) noexcept {
+				auto tmp = *this;
+				++pos;
+				return tmp;
+			}
+
+			/// Compare iterators
+			bool operator==(const iterator& other) const noexcept {
+				return pos == other.pos && strings == other.strings;
+			}
+
+			/// Compare iterators
+			bool operator!=(const iterator& other) const noexcept {
+				return !(*this == other);
+			}
+
+		private:
+			const PackedStrings* strings;
+			mint pos;
+		};
+
+		/// Strings cannot be modified in place, so the const iterator is the same as the regular one
+		using const_iterator = iterator;
+
+		/**
+		 * @brief   Create an empty list of strings
+		 */
+		PackedStrings() = default;
+
+		/**
+		 * @brief   Create PackedStrings from bytes and offsets
+		 * @param   bytes - NumericArray with UTF-8 bytes of all strings
+		 * @param   offsets - rank 1 NumericArray of positions in \p bytes where consecutive strings start, followed by the total number of bytes
+		 * @throws  ErrorName::DimensionsError - if \p offsets do not describe a valid partition of \p bytes into strings
+		 */
+		PackedStrings(NumericArray<std::uint8_t> bytes, NumericArray<mint> offsets) : packed {std::move(bytes), std::move(offsets)} {}
+
+		/**
+		 * @brief   Create PackedStrings from a RaggedArray of bytes
+		 * @param   ra - RaggedArray whose rows are UTF-8 encoded strings
+		 */
+		explicit PackedStrings(RaggedArray<std::uint8_t> ra) : packed {std::move(ra)} {}
+
+		/**
+		 * @brief   Create PackedStrings from a DataList with two NumericArray nodes: bytes and offsets (node names are ignored)
+		 * @param   dl - DataList received from the Wolfram Language
+		 * @throws  ErrorName::DimensionsError - if the DataList does not have exactly two nodes or offsets are invalid
+		 */
+		explicit PackedStrings(const DataList<NodeType::NumericArray>& dl) : packed {dl} {}
+
+		/**
+		 * @brief   Pack strings from a range, e.g. a std::vector<std::string> or node values of a DataList<NodeType::UTF8String>
+		 * @tparam  ForwardIt - forward iterator over values convertible to std::string_view
+		 * @param   first - iterator to the first string
+		 * @param   last - iterator past the last string
+		 * @return  new PackedStrings
+		 * @note    The range is traversed twice, first to compute the total size, so that both NumericArrays are allocated only once.
+		 */
+		template<typename ForwardIt>
+		static PackedStrings fromRange(ForwardIt first, ForwardIt last);
+
+		/// Get the number of strings
+		[[nodiscard]] mint size() const noexcept {
+			return packed.rowCount();
+		}
+
+		/// Check if there are no strings
+		[[nodiscard]] bool empty() const noexcept {
+			return size() == 0;
+		}
+
+		/// Get the total number of bytes of all strings
+		[[nodiscard]] mint byteCount() const noexcept {
+			return packed.valueCount();
+		}
+
+		/**
+		 * @brief   Get the string at given position, in constant time and without copying
+		 * @param   index - position of the string, must be smaller than size()
+		 * @return  view over the string, valid as long as the PackedStrings object is alive
+		 */
+		std::string_view operator[](mint index) const noexcept {
+			const auto& offsets = packed.offsets();
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): UTF-8 bytes are read as characters
+			const auto* first = reinterpret_cast<const char*>(packed.values().data()) + offsets[index];
+			return {first, static_cast<std::size_t>(offsets[index + 1] - offsets[index])};
+		}
+
+		/**
+		 * @brief   Get the string at given position, with bounds checking
+		 * @param   index - position of the string
+		 * @return  view over the string, valid as long as the PackedStrings object is alive
+		 * @throws  ErrorName::MArrayElementIndexError - if \p index is out of range
+		 */
+		std::string_view at(mint index) const {
+			if (index < 0 || index >= size()) {
+				ErrorManager::throwException(ErrorName::MArrayElementIndexError, index);
+			}
+			return (*this)[index];
+		}
+
+		/// Get an iterator to the first string
+		iterator begin() const noexcept {
+			return {this, 0};
+		}
+
+		/// Get an iterator past the last string
+		iterator end() const noexcept {
+			return {this, size()};
+		}
+
+		/// Get the NumericArray with bytes of all strings
+		const NumericArray<std::uint8_t>& bytes() const noexcept {
+			return packed.values();
+		}
+
+		/// Get the NumericArray with string offsets
+		const NumericArray<mint>& offsets() const noexcept {
+			return packed.offsets();
+		}
+
+		/**
+		 * @brief   Move bytes and offsets into a DataList with nodes "Values" and "Offsets", which can be returned from a library function
+		 * @return  DataList with two NumericArray nodes
+		 */
+		DataList<NodeType::NumericArray> toDataList() && {
+			return std::move(packed).toDataList();
+		}
+
+		/**
+		 * @brief   Copy bytes and offsets into a DataList with nodes "Values" and "Offsets", which can be returned from a library function
+		 * @return  DataList with two NumericArray nodes
+		 */
+		DataList<NodeType::NumericArray> toDataList() const& {
+			return packed.toDataList();
+		}
+
+	private:
+		RaggedArray<std::uint8_t> packed;
+	};
+
+	template<typename ForwardIt>
+	PackedStrings PackedStrings::fromRange(ForwardIt first, ForwardIt last) {
+		mint count = 0;
+		mint total = 0;
+		for (auto it = first; it != last; ++it, ++count) {
+			total += static_cast<mint>(std::string_view {*it}.size());
+		}
+		NumericArray<std::uint8_t> bytes(std::uint8_t {}, MArrayDimensions {total});
+		NumericArray<mint> offsets(0, MArrayDimensions {count + 1});
+		auto* out = bytes.data();
+		for (mint i = 0; first != last; ++first, ++i) {
+			std::string_view s {*first};
+			std::copy(s.begin(), s.end(), out + offsets[i]);
+			offsets[i + 1] = offsets[i] + static_cast<mint>(s.size());
+		}
+		return {std::move(bytes), std::move(offsets)};
+	}
+
+	/// PackedStrings can be passed to library functions as two arguments: a NumericArray of bytes and a NumericArray of offsets
+	template<>
+	struct MArgumentManager::CustomType<PackedStrings> {
+		/// PackedStrings are constructed from a NumericArray of bytes and a NumericArray of offsets
+		using CorrespondingTypes = std::tuple<NumericArray<std::uint8_t>, NumericArray<mint>>;
+	};
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_PACKEDSTRINGS_HPP
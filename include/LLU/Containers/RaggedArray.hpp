@@ -0,0 +1,364 @@
+/**
+ * @file	RaggedArray.hpp
+ * @brief	List of vectors of different lengths stored in two flat NumericArrays.
+ *
+ * RaggedArray is the compact alternative to a DataList of NumericArrays: all values are stored in one NumericArray and rows are delimited by
+ * an array of offsets, so creating, passing and returning a RaggedArray costs two Kernel allocations regardless of the number of rows.
+ * In the Wolfram Language a RaggedArray is represented as a pair of NumericArrays {values, offsets} and the list of rows can be recovered with
+ * TakeList[Normal[values], Differences[Normal[offsets]]].
+ */
+#ifndef LLU_CONTAINERS_RAGGEDARRAY_HPP
+#define LLU_CONTAINERS_RAGGEDARRAY_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "LLU/Async/Utilities.h"
+#include "LLU/Containers/DataList.h"
+#include "LLU/Containers/Iterators/IterableContainer.hpp"
+#include "LLU/Containers/NumericArray.h"
+#include "LLU/ErrorLog/ErrorManager.h"
+#include "LLU/MArgumentManager.h"
+
+namespace LLU {
+
+	/**
+	 * @brief   View over a single row of a RaggedArray
+	 * @tparam  T - type of elements, may be const-qualified
+	 */
+	template<typename T>
+	class RaggedRow : public IterableContainer<T> {
+	public:
+		/**
+		 * @brief   Create a view over \p length elements starting at \p data
+		 * @param   data - pointer to the first element of the row
+		 * @param   length - number of elements in the row
+		 */
+		RaggedRow(T* data, mint length) noexcept : buffer {data}, len {length} {}
+
+	private:
+		T* getData() const noexcept override {
+			return buffer;
+		}
+
+		mint getSize() const noexcept override {
+			return len;
+		}
+
+		T* buffer;
+		mint len;
+	};
+
+	/**
+	 * @brief   List of vectors (rows) of possibly different lengths, backed by a NumericArray of values and a NumericArray of row offsets
+	 *
+	 * Row \c i consists of values at positions [offsets[i], offsets[i + 1]), so offsets has one element more than there are rows, the first offset
+	 * is always 0 and the last one equals the total number of values.
+	 *
+	 * @tparam  T - type of elements, any type supported by NumericArray
+	 */
+	template<typename T>
+	class RaggedArray {
+	public:
+		/// Type of elements
+		using value_type = T;
+
+		/// Type of a view over a mutable row
+		using row_type = RaggedRow<T>;
+
+		/// Type of a view over a constant row
+		using const_row_type = RaggedRow<const T>;
+
+		/// Iterator over rows
+		template<typename Row>
+		class RowIterator {
+		public:
+			/// @cond
+			using iterator_category = std::input_iterator_tag;
+			using value_type = Row;
+			using difference_type = mint;
+			using pointer = void;
+			using reference = Row;
+			/// @endcond
+
+			/// Create an iterator over rows of \p ra starting at row \p index
+			RowIterator(std::conditional_t<std::is_const_v<typename Row::value_type>, const RaggedArray, RaggedArray>* ra, mint index) noexcept
+				: array {ra}, row {index} {}
+
+			/// Get a view over the current row
+			Row operator*() const {
+				return (*array)[row];
+			}
+
+			/// Move to the next row
+			RowIterator& operator++() noexcept {
+				++row;
+				return *this;
+			}
+
+			/// Move to the next row, return the iterator to the previous one
+			RowIterator operator++(int) noexcept {
+				auto tmp = *this;
+				++row;
+				return tmp;
+			}
+
+			/// Compare iterators
+			bool operator==(const RowIterator& other) const noexcept {
+				return row == other.row && array == other.array;
+			}
+
+			/// Compare iterators
+			bool operator!=(const RowIterator& other) const noexcept {
+				return !(*this == other);
+			}
+
+		private:
+			std::conditional_t<std::is_const_v<typename Row::value_type>, const RaggedArray, RaggedArray>* array;
+			mint row;
+		};
+
+		/// Iterator over mutable rows
+		using iterator = RowIterator<row_type>;
+
+		/// Iterator over constant rows
+		using const_iterator = RowIterator<const_row_type>;
+
+	public:
+		/**
+		 * @brief   Create an empty RaggedArray, with no rows
+		 */
+		RaggedArray() : RaggedArray(NumericArray<T>(T {}, MArrayDimensions {0}), NumericArray<mint> {0}) {}
+
+		/**
+		 * @brief   Create a RaggedArray from values and offsets
+		 * @param   values - NumericArray with elements of all rows
+		 * @param   offsets - rank 1 NumericArray of positions in \p values where consecutive rows start, followed by the total number of values
+		 * @throws  ErrorName::DimensionsError - if \p offsets do not describe a valid partition of \p values into rows
+		 */
+		RaggedArray(NumericArray<T> values, NumericArray<mint> offsets) : vals {std::move(values)}, offs {std::move(offsets)} {
+			validate();
+		}
+
+		/**
+		 * @brief   Create a RaggedArray with rows of given lengths
+		 * @param   lengths - collection of row lengths
+		 * @param   init - initial value of elements
+		 */
+		template<typename Container, typename = std::enable_if_t<std::conjunction_v<std::is_class<Container>, is_iterable<Container>>>>
+		explicit RaggedArray(const Container& lengths, T init = T {}) : RaggedArray(init, offsetsFromLengths(std::begin(lengths), std::end(lengths))) {}
+
+		/**
+		 * @brief   Create a RaggedArray from a DataList with two NumericArray nodes: values and offsets (node names are ignored)
+		 * @param   dl - DataList received from the Wolfram Language
+		 * @throws  ErrorName::DimensionsError - if the DataList does not have exactly two nodes or offsets are invalid
+		 */
+		explicit RaggedArray(const DataList<NodeType::NumericArray>& dl) : RaggedArray(fromDataList(dl)) {}
+
+		/**
+		 * @brief   Create a RaggedArray by copying rows from a collection of containers, e.g. std::vector<std::vector<T>> or a list of NumericArrays
+		 * @param   rows - collection of iterable rows
+		 * @return  new RaggedArray
+		 */
+		template<typename Rows>
+		static RaggedArray fromRows(const Rows& rows) {
+			std::vector<mint> lengths;
+			for (const auto& r : rows) {
+				lengths.push_back(static_cast<mint>(std::distance(std::begin(r), std::end(r))));
+			}
+			RaggedArray res {lengths};
+			mint i = 0;
+			for (const auto& r : rows) {
+				std::copy(std::begin(r), std::end(r), res[i++].begin());
+			}
+			return res;
+		}
+
+		/// Get the number of rows
+		[[nodiscard]] mint rowCount() const noexcept {
+			return offs.size() - 1;
+		}
+
+		/// Get the number of rows
+		[[nodiscard]] mint size() const noexcept {
+			return rowCount();
+		}
+
+		/// Get the total number of values in all rows
+		[[nodiscard]] mint valueCount() const noexcept {
+			return vals.size();
+		}
+
+		/// Get the length of row \p index
+		[[nodiscard]] mint rowLength(mint index) const {
+			checkRowIndex(index);
+			return offs[index + 1] - offs[index];
+		}
+
+		/**
+		 * @brief   Get a view over the row at given position, in constant time
+		 * @param   index - 0-based row index
+		 * @return  view over the row, valid as long as the RaggedArray is alive
+		 */
+		row_type operator[](mint index) {
+			checkRowIndex(index);
+			return {vals.data() + offs[index], offs[index + 1] - offs[index]};
+		}
+
+		/// @copydoc operator[]
+		const_row_type operator[](mint index) const {
+			checkRowIndex(index);
+			return {vals.data() + offs[index], offs[index + 1] - offs[index]};
+		}
+
+		/// Get an iterator to the first row
+		iterator begin() noexcept {
+			return {this, 0};
+		}
+
+		/// Get an iterator past the last row
+		iterator end() noexcept {
+			return {this, rowCount()};
+		}
+
+		/// Get an iterator to the first row
+		const_iterator begin() const noexcept {
+			return {this, 0};
+		}
+
+		/// Get an iterator past the last row
+		const_iterator end() const noexcept {
+			return {this, rowCount()};
+		}
+
+		/// Get the NumericArray with values of all rows
+		const NumericArray<T>& values() const noexcept {
+			return vals;
+		}
+
+		/// Get the NumericArray with row offsets
+		const NumericArray<mint>& offsets() const noexcept {
+			return offs;
+		}
+
+		/**
+		 * @brief   Call \p f on every row, in order
+		 * @param   f - callable taking a row_type and optionally the row index
+		 */
+		template<typename F>
+		void transformRows(F&& f) {
+			transformRowRange(f, 0, rowCount());
+		}
+
+		/**
+		 * @brief   Call \p f on every row, distributing the rows among tasks on a thread pool
+		 * @param   pool - thread pool, for example LLU::ThreadPool or LLU::BasicPool
+		 * @param   f - callable taking a row_type and optionally the row index, it will be called concurrently for different rows
+		 * @param   chunkCount - number of tasks, by default the number of hardware threads
+		 * @note    Rows are split into chunks with roughly the same number of values, not the same number of rows, so that the work is balanced even
+		 *          if row lengths differ a lot. The calling thread processes one of the chunks, so this function must not be called from a task running
+		 *          on the same pool. The first exception thrown by \p f is rethrown after all tasks finish.
+		 */
+		template<typename Pool, typename F>
+		void transformRows(Pool& pool, F&& f, unsigned chunkCount = std::thread::hardware_concurrency()) {
+			const mint chunks = std::clamp<mint>(chunkCount, 1, std::max<mint>(rowCount(), 1));
+			std::vector<mint> bounds {0};
+			for (mint c = 1; c < chunks; ++c) {
+				const mint target = valueCount() * c / chunks;
+				auto pos = std::lower_bound(offs.begin(), offs.end() - 1, target) - offs.begin();
+				bounds.push_back(std::max(bounds.back(), static_cast<mint>(pos)));
+			}
+			bounds.push_back(rowCount());
+			Async::runTasks(pool, bounds.size() - 1, [this, &f, &bounds](std::size_t c) { transformRowRange(f, bounds[c], bounds[c + 1]); });
+		}
+
+		/**
+		 * @brief   Move values and offsets into a DataList with nodes "Values" and "Offsets", which can be returned from a library function
+		 * @return  DataList with two NumericArray nodes
+		 */
+		DataList<NodeType::NumericArray> toDataList() && {
+			DataList<NodeType::NumericArray> res;
+			res.push_back("Values", std::move(vals));
+			res.push_back("Offsets", std::move(offs));
+			return res;
+		}
+
+		/**
+		 * @brief   Copy values and offsets into a DataList with nodes "Values" and "Offsets", which can be returned from a library function
+		 * @return  DataList with two NumericArray nodes
+		 */
+		DataList<NodeType::NumericArray> toDataList() const& {
+			return RaggedArray {vals.clone(), offs.clone()}.toDataList();
+		}
+
+	private:
+		RaggedArray(T init, NumericArray<mint> offsets)
+			: vals {init, MArrayDimensions {offsets[offsets.size() - 1]}}, offs {std::move(offsets)} {}
+
+		template<typename InputIt>
+		static NumericArray<mint> offsetsFromLengths(InputIt first, InputIt last) {
+			std::vector<mint> res {0};
+			for (; first != last; ++first) {
+				const auto len = static_cast<mint>(*first);
+				if (len < 0) {
+					ErrorManager::throwExceptionWithDebugInfo(ErrorName::DimensionsError, "Negative row length");
+				}
+				res.push_back(res.back() + len);
+			}
+			return NumericArray<mint> {res};
+		}
+
+		static RaggedArray fromDataList(const DataList<NodeType::NumericArray>& dl) {
+			if (dl.length() != 2) {
+				ErrorManager::throwExceptionWithDebugInfo(ErrorName::DimensionsError, "RaggedArray requires a DataList with values and offsets");
+			}
+			auto node = dl.begin();
+			auto valuesNode = *node;
+			auto offsetsNode = *(++node);
+			return {NumericArray<T> {std::move(valuesNode.value())}, NumericArray<mint> {std::move(offsetsNode.value())}};
+		}
+
+		void validate() const {
+			const bool valid = offs.rank() == 1 && offs.size() > 0 && offs[0] == 0 && offs[offs.size() - 1] == vals.size() &&
+							   std::is_sorted(offs.begin(), offs.end());
+			if (!valid) {
+				ErrorManager::throwExceptionWithDebugInfo(ErrorName::DimensionsError, "Invalid offsets of a RaggedArray");
+			}
+		}
+
+		void checkRowIndex(mint index) const {
+			if (index < 0 || index >= rowCount()) {
+				ErrorManager::throwException(ErrorName::MArrayElementIndexError, index);
+			}
+		}
+
+		template<typename F>
+		void transformRowRange(F& f, mint first, mint last) {
+			for (mint i = first; i < last; ++i) {
+				if constexpr (std::is_invocable_v<F&, row_type, mint>) {
+					f((*this)[i], i);
+				} else {
+					f((*this)[i]);
+				}
+			}
+		}
+
+		NumericArray<T> vals;
+		NumericArray<mint> offs;
+	};
+
+	/// RaggedArray can be passed to library functions as two arguments: a NumericArray of values and a NumericArray of offsets
+	template<typename T>
+	struct MArgumentManager::CustomType<RaggedArray<T>> {
+		/// RaggedArray is constructed from a NumericArray of values and a NumericArray of offsets
+		using CorrespondingTypes = std::tuple<NumericArray<T>, NumericArray<mint>>;
+	};
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_RAGGEDARRAY_HPP
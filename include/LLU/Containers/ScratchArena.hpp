@@ -0,0 +1,227 @@
+/**
+ * @file	ScratchArena.hpp
+ * @brief	Per-call arena for temporary arrays that never leave the library.
+ *
+ * Library functions that work in several stages often need intermediate arrays which are discarded before the function returns. Creating them
+ * as NumericArray or Tensor means a round trip to the Kernel memory manager for every temporary. ScratchArena instead hands out slices of a few
+ * large, 64-byte aligned blocks of LLU-owned memory, wrapped in ScratchArray which has the same interface as other MArrays (iterators, rank,
+ * dimensions, multi-index access). Only the final result needs to be copied into a Kernel container with ScratchArray::toNumericArray or toTensor.
+ *
+ * A typical use is to create the arena next to the MArgumentManager, so that all scratch memory is released when the library function returns:
+ * @code
+ * 	LLU_LIBRARY_FUNCTION(Pipeline) {
+ * 		LLU::ScratchArena arena;
+ * 		auto tmp = arena.allocate<double>({rows, cols});
+ * 		...
+ * 		mngr.set(tmp.toNumericArray());
+ * 	}
+ * @endcode
+ */
+#ifndef LLU_CONTAINERS_SCRATCHARENA_HPP
+#define LLU_CONTAINERS_SCRATCHARENA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "LLU/Containers/MArray.hpp"
+#include "LLU/Containers/NumericArray.h"
+#include "LLU/Containers/Tensor.h"
+
+namespace LLU {
+
+	/**
+	 * @brief   Typed, non-owning view over a buffer allocated from a ScratchArena
+	 * @tparam  T - type of elements
+	 * @note    ScratchArray is valid only as long as the arena it comes from is alive and has not been reset.
+	 */
+	template<typename T>
+	class ScratchArray : public MArray<T> {
+	public:
+		ScratchArray() = default;
+
+		/**
+		 * @brief   Create a view over given buffer
+		 * @param   buffer - pointer to at least dims.flatCount() elements
+		 * @param   dims - dimensions of the array
+		 */
+		ScratchArray(T* buffer, MArrayDimensions dims) : MArray<T>(std::move(dims)), buffer {buffer} {}
+
+		/**
+		 * @brief   Copy data into a new NumericArray of the same dimensions
+		 * @return  NumericArray owned by the library
+		 */
+		NumericArray<T> toNumericArray() const {
+			return {this->cbegin(), this->cend(), this->dimensions()};
+		}
+
+		/**
+		 * @brief   Copy data into a new Tensor of the same dimensions
+		 * @return  Tensor owned by the library
+		 */
+		Tensor<T> toTensor() const {
+			return {this->cbegin(), this->cend(), this->dimensions()};
+		}
+
+	private:
+		T* getData() const noexcept override {
+			return buffer;
+		}
+
+		/// Memory owned by the arena
+		T* buffer = nullptr;
+	};
+
+	/**
+	 * @brief   Bump allocator of aligned memory for temporary arrays, all allocated memory is released at once
+	 *
+	 * Memory is taken from the system in blocks of at least the block size given in the constructor. Allocations that do not fit into the current
+	 * block open a new one. Calling reset() makes the memory available for reuse, merging all blocks into one, so that a sequence of allocations
+	 * repeated after reset() is served from a single block with no calls to the system allocator.
+	 */
+	class ScratchArena {
+	public:
+		/// Alignment (in bytes) of every buffer returned by the arena
+		static constexpr std::size_t Alignment = 64;
+
+		/// Default size of a memory block (in bytes)
+		static constexpr std::size_t DefaultBlockSize = std::size_t {1} << 20U;
+
+		/**
+		 * @brief   Create an empty arena, no memory is allocated until the first request
+		 * @param   blockSize - minimal size of memory blocks requested from the system
+		 */
+		explicit ScratchArena(std::size_t blockSize = DefaultBlockSize) : minBlockSize {roundUp(std::max(blockSize, Alignment))} {}
+
+		ScratchArena(const ScratchArena&) = delete;
+		ScratchArena& operator=(const ScratchArena&) = delete;
+		ScratchArena(ScratchArena&&) noexcept = default;
+		ScratchArena& operator=(ScratchArena&&) noexcept = default;
+		~ScratchArena() = default;
+
+		/**
+		 * @brief   Allocate an uninitialized array
+		 * @tparam  T - type of elements, must be trivially copyable and trivially destructible
+		 * @param   dims - dimensions of the array
+		 * @return  view over the new array
+		 */
+		template<typename T>
+		ScratchArray<T> allocate(MArrayDimensions dims) {
+			static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>, "ScratchArena can only store trivial types.");
+			static_assert(alignof(T) <= Alignment, "Type alignment exceeds the alignment of ScratchArena buffers.");
+			auto* buffer = static_cast<T*>(allocateBytes(static_cast<std::size_t>(dims.flatCount()) * sizeof(T)));
+			return {buffer, std::move(dims)};
+		}
+
+		/**
+		 * @brief   Allocate an array with all elements equal to \p init
+		 * @tparam  T - type of elements, must be trivially copyable and trivially destructible
+		 * @param   dims - dimensions of the array
+		 * @param   init - initial value of all elements
+		 * @return  view over the new array
+		 */
+		template<typename T>
+		ScratchArray<T> allocate(MArrayDimensions dims, T init) {
+			auto res = allocate<T>(std::move(dims));
+			std::fill(res.begin(), res.end(), init);
+			return res;
+		}
+
+		/**
+		 * @brief   Allocate raw memory
+		 * @param   bytes - number of bytes
+		 * @return  pointer to a memory region aligned to ScratchArena::Alignment bytes
+		 * @throws  std::bad_alloc - if the system allocator fails
+		 */
+		void* allocateBytes(std::size_t bytes) {
+			const std::size_t size = roundUp(std::max(bytes, std::size_t {1}));
+			if (blocks.empty() || blocks.back().size - blocks.back().used < size) {
+				blocks.push_back(newBlock(std::max(size, minBlockSize)));
+			}
+			Block& block = blocks.back();
+			void* res = block.memory.get() + block.used;
+			block.used += size;
+			++allocations;
+			return res;
+		}
+
+		/**
+		 * @brief   Make all memory available for reuse. All arrays allocated before are invalidated.
+		 * @note    If the arena consists of more than one block, the blocks are replaced by a single block of the same total capacity.
+		 */
+		void reset() {
+			if (blocks.size() > 1) {
+				const std::size_t total = capacity();
+				blocks.clear();
+				blocks.push_back(newBlock(total));
+			}
+			for (auto& block : blocks) {
+				block.used = 0;
+			}
+		}
+
+		/// Get the number of allocations served by the arena since it was created
+		[[nodiscard]] std::size_t allocationCount() const noexcept {
+			return allocations;
+		}
+
+		/// Get the number of memory blocks requested from the system since the arena was created
+		[[nodiscard]] std::size_t systemAllocationCount() const noexcept {
+			return systemAllocations;
+		}
+
+		/// Get the number of bytes currently handed out, including padding
+		[[nodiscard]] std::size_t bytesInUse() const noexcept {
+			std::size_t res = 0;
+			for (const auto& block : blocks) {
+				res += block.used;
+			}
+			return res;
+		}
+
+		/// Get the total size of memory blocks owned by the arena
+		[[nodiscard]] std::size_t capacity() const noexcept {
+			std::size_t res = 0;
+			for (const auto& block : blocks) {
+				res += block.size;
+			}
+			return res;
+		}
+
+	private:
+		/// Deleter for memory allocated with aligned operator new
+		struct AlignedDelete {
+			void operator()(std::byte* p) const noexcept {
+				::operator delete(p, std::align_val_t {Alignment});
+			}
+		};
+
+		/// Contiguous region of memory from which buffers are handed out
+		struct Block {
+			std::unique_ptr<std::byte, AlignedDelete> memory;
+			std::size_t size = 0;
+			std::size_t used = 0;
+		};
+
+		static std::size_t roundUp(std::size_t bytes) noexcept {
+			return (bytes + Alignment - 1) / Alignment * Alignment;
+		}
+
+		Block newBlock(std::size_t size) {
+			++systemAllocations;
+			return {std::unique_ptr<std::byte, AlignedDelete> {static_cast<std::byte*>(::operator new(size, std::align_val_t {Alignment}))}, size, 0};
+		}
+
+		std::vector<Block> blocks;
+		std::size_t minBlockSize;
+		std::size_t allocations = 0;
+		std::size_t systemAllocations = 0;
+	};
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_SCRATCHARENA_HPP
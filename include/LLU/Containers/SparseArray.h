@@ -0,0 +1,182 @@
+/**
+ * @file	SparseArray.h
+ * @brief	Templated C++ wrapper for MSparseArray
+ *
+ */
+#ifndef LLU_CONTAINERS_SPARSEARRAY_H_
+#define LLU_CONTAINERS_SPARSEARRAY_H_
+
+#include "LLU/Containers/Generic/SparseArray.hpp"
+#include "LLU/Containers/MArrayDimensions.h"
+#include "LLU/Containers/Tensor.h"
+#include "LLU/Containers/Views/Tensor.hpp"
+#include "LLU/LibraryData.h"
+#include "LLU/Utilities.hpp"
+
+namespace LLU {
+
+	/**
+	 * @class SparseArray
+	 * @brief Strongly typed wrapper for MSparseArray.
+	 *
+	 * SparseArray gives direct access to the compressed sparse row (CSR) representation of the underlying MSparseArray.
+	 * Row pointers, column indices and explicit values are exposed as TensorTypedViews over MTensors owned by the MSparseArray, so no data
+	 * is copied, but the views are only valid as long as the SparseArray is alive and its implicit value is not changed.
+	 *
+	 * @tparam	T - type of underlying data, must be one of the types supported by Tensor (mint, double or std::complex<double>)
+	 */
+	template<typename T>
+	class SparseArray : public GenericSparseArray {
+	public:
+		/// Type of elements stored
+		using value_type = T;
+
+		/**
+		 *  @brief  Default constructor, creates a SparseArray that does not wrap over any raw MSparseArray
+		 */
+		SparseArray() = default;
+
+		/**
+		 *   @brief     Constructs SparseArray based on MSparseArray
+		 *   @param[in] t - LibraryLink structure to be wrapped
+		 *   @param[in] owner - who manages the memory the raw MSparseArray
+		 *   @throws    ErrorName::SparseArrayTypeError - if the SparseArray template type \b T does not match the actual data type of the MSparseArray
+		 **/
+		SparseArray(MSparseArray t, Ownership owner);
+
+		/**
+		 *   @brief     Create new SparseArray from a GenericSparseArray
+		 *   @param[in] t - generic SparseArray to be wrapped into SparseArray class
+		 *   @throws	ErrorName::SparseArrayTypeError - if the SparseArray template type \b T does not match the actual data type of the generic SparseArray
+		 **/
+		explicit SparseArray(GenericSparseArray t);
+
+		/**
+		 *   @brief     Constructs SparseArray from explicit positions and values (COO triplets)
+		 *   @param[in] positions - integer matrix of shape {nnz, rank} with 1-based positions of explicit values
+		 *   @param[in] values - vector of nnz explicit values
+		 *   @param[in] dims - dimensions of the new SparseArray
+		 *   @param[in] implicitValue - value of all elements that are not stored explicitly
+		 *   @throws    ErrorName::SparseArrayFromPositionsError - if the MSparseArray could not be created
+		 **/
+		SparseArray(const Tensor<mint>& positions, const Tensor<T>& values, const MArrayDimensions& dims, T implicitValue = T {});
+
+		/**
+		 *   @brief     Constructs SparseArray from a dense Tensor
+		 *   @param[in] data - dense Tensor, all elements different from \p implicitValue will be stored explicitly
+		 *   @param[in] implicitValue - implicit value of the new SparseArray
+		 *   @throws    ErrorName::SparseArrayFromTensorError - if the MSparseArray could not be created
+		 **/
+		explicit SparseArray(const Tensor<T>& data, T implicitValue = T {});
+
+		/**
+		 * @brief   Clone this SparseArray, performing a deep copy of the underlying MSparseArray.
+		 * @note    The cloned MSparseArray always belongs to the library (Ownership::Library) because LibraryLink has no idea of its existence.
+		 * @return  new SparseArray
+		 */
+		SparseArray clone() const {
+			return SparseArray {cloneContainer(), Ownership::Library};
+		}
+
+		/**
+		 * @brief   Get dimensions of the SparseArray
+		 * @return  MArrayDimensions object with SparseArray dimensions
+		 */
+		MArrayDimensions dimensions() const {
+			return {getDimensions(), getRank()};
+		}
+
+		/**
+		 * @brief   Get the number of explicitly stored elements
+		 */
+		mint explicitCount() const {
+			return LibraryData::API()->MTensor_getFlattenedLength(explicitValuesTensor());
+		}
+
+		/**
+		 * @brief   Get the implicit value of the SparseArray
+		 */
+		T implicitValue() const {
+			return *static_cast<T*>(TensorView {implicitValueTensor()}.rawData());
+		}
+
+		/**
+		 * @brief   Change the implicit value of the SparseArray.
+		 * @param   newImplicitValue - new implicit value
+		 * @note    This replaces the underlying MSparseArray, so all previously obtained views become invalid.
+		 */
+		void setImplicitValue(T newImplicitValue) {
+			resetImplicitValue(scalarTensor(newImplicitValue));
+		}
+
+		/**
+		 * @brief   Get a non-owning view of explicit values (the CSR value array)
+		 * @return  vector of length explicitCount()
+		 */
+		TensorTypedView<T> explicitValues() const {
+			return explicitValuesTensor();
+		}
+
+		/**
+		 * @brief   Get a non-owning view of CSR row pointers
+		 * @return  vector of length getDimensions()[0] + 1 with 0-based offsets into explicitValues() and columnIndices()
+		 */
+		TensorTypedView<mint> rowPointers() const {
+			return rowPointersTensor();
+		}
+
+		/**
+		 * @brief   Get a non-owning view of CSR column indices
+		 * @return  matrix of shape {explicitCount(), getRank() - 1} with 1-based indices of explicit values in all dimensions except the first
+		 */
+		TensorTypedView<mint> columnIndices() const {
+			return columnIndicesTensor();
+		}
+
+		/**
+		 * @brief   Compute positions of all explicit values (COO format)
+		 * @return  new Tensor of shape {explicitCount(), getRank()} with 1-based positions, owned by the library
+		 */
+		Tensor<mint> explicitPositions() const {
+			return Tensor<mint> {getExplicitPositions()};
+		}
+
+		/**
+		 * @brief   Create a dense Tensor with the same contents as this SparseArray
+		 * @return  new Tensor owned by the library
+		 */
+		Tensor<T> toTensor() const {
+			return Tensor<T> {toGenericTensor()};
+		}
+
+	private:
+		using GenericBase = MContainer<MArgumentType::SparseArray>;
+
+		/// Create a rank 0 GenericTensor holding a single value
+		static GenericTensor scalarTensor(T value) {
+			GenericTensor scalar {TensorType<T>, 0, nullptr};
+			*static_cast<T*>(scalar.rawData()) = value;
+			return scalar;
+		}
+	};
+
+	template<typename T>
+	SparseArray<T>::SparseArray(GenericBase t) : GenericBase(std::move(t)) {
+		if (TensorType<T> != GenericBase::type()) {
+			ErrorManager::throwException(ErrorName::SparseArrayTypeError);
+		}
+	}
+
+	template<typename T>
+	SparseArray<T>::SparseArray(MSparseArray t, Ownership owner) : SparseArray(GenericBase {t, owner}) {}
+
+	template<typename T>
+	SparseArray<T>::SparseArray(const Tensor<mint>& positions, const Tensor<T>& values, const MArrayDimensions& dims, T implicitValue)
+		: GenericBase(positions, values, Tensor<mint>(dims.get()), scalarTensor(implicitValue)) {}
+
+	template<typename T>
+	SparseArray<T>::SparseArray(const Tensor<T>& data, T implicitValue) : GenericBase(data, scalarTensor(implicitValue)) {}
+
+} /* namespace LLU */
+
+#endif /* LLU_CONTAINERS_SPARSEARRAY_H_ */
@@ -0,0 +1,317 @@
+/**
+ * @file	SparseKernels.hpp
+ * @brief	Parallel linear algebra kernels operating on the CSR representation of SparseArray.
+ *
+ * All kernels split the rows of a sparse matrix into chunks with approximately the same amount of work (explicit elements plus a constant cost
+ * per row) and process the chunks on a thread pool. The calling thread processes one chunk itself and then waits for the remaining ones,
+ * so kernels must not be called from inside a task running on the same pool.
+ */
+#ifndef LLU_CONTAINERS_SPARSEKERNELS_HPP
+#define LLU_CONTAINERS_SPARSEKERNELS_HPP
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "LLU/Async/Utilities.h"
+#include "LLU/Containers/SparseArray.h"
+#include "LLU/Containers/Tensor.h"
+#include "LLU/Containers/Views/Tensor.hpp"
+#include "LLU/ErrorLog/ErrorManager.h"
+
+namespace LLU::Sparse {
+
+	/**
+	 * @brief   Split rows of a CSR matrix into chunks of similar cost
+	 * @param   rowPointers - CSR row pointers, a vector of length rows + 1
+	 * @param   chunkCount - desired number of chunks
+	 * @return  non-decreasing vector of row boundaries, starting with 0 and ending with the number of rows; chunk i covers rows [b[i], b[i+1])
+	 * @note    The cost of a row is estimated as the number of explicit elements in that row plus one, so that rows with no explicit elements are
+	 *          distributed evenly as well. Empty chunks are removed, hence the result may contain fewer than chunkCount + 1 elements.
+	 */
+	inline std::vector<mint> balancedRowPartition(const TensorTypedView<mint>& rowPointers, unsigned chunkCount) {
+		const mint rows = rowPointers.size() - 1;
+		const mint totalCost = rowPointers[rows] - rowPointers[0] + rows;
+		std::vector<mint> bounds {0};
+		chunkCount = std::max(chunkCount, 1U);
+		for (unsigned chunk = 1; chunk < chunkCount; ++chunk) {
+			const mint target = totalCost * chunk / chunkCount;
+			// find the first row r such that the cost of rows [0, r) is at least target
+			mint lo = bounds.back();
+			mint hi = rows;
+			while (lo < hi) {
+				mint mid = lo + (hi - lo) / 2;
+				if (rowPointers[mid] - rowPointers[0] + mid < target) {
+					lo = mid + 1;
+				} else {
+					hi = mid;
+				}
+			}
+			if (lo > bounds.back() && lo < rows) {
+				bounds.push_back(lo);
+			}
+		}
+		bounds.push_back(rows);
+		return bounds;
+	}
+
+	/// @cond
+	namespace Detail {
+		/// Check that given SparseArray is a matrix and return its dimensions
+		template<typename T>
+		std::pair<mint, mint> matrixDimensions(const SparseArray<T>& a) {
+			if (a.getRank() != 2) {
+				ErrorManager::throwExceptionWithDebugInfo(ErrorName::RankError, "Sparse kernels require a matrix, got rank " + std::to_string(a.getRank()));
+			}
+			return {a.getDimensions()[0], a.getDimensions()[1]};
+		}
+
+		/// Run f(firstRow, lastRow, chunkIndex) for each chunk defined by bounds, the first chunk in the calling thread and the others on the pool
+		template<typename Pool, typename F>
+		void forEachRowChunk(Pool& pool, const std::vector<mint>& bounds, F&& f) {
+			if (bounds.size() < 2) {
+				return;
+			}
+			Async::runTasks(pool, bounds.size() - 1, [&f, &bounds](size_t chunk) { f(bounds[chunk], bounds[chunk + 1], chunk); });
+		}
+
+		/// Default number of chunks used by the kernels
+		inline unsigned defaultChunkCount() {
+			return std::max(std::thread::hardware_concurrency(), 1U);
+		}
+
+		/// Sparse matrix - dense vector product, Dot[a, x] = Dot[a - implicit, x] + implicit * Total[x]
+		template<typename Pool, typename T>
+		Tensor<T> matrixVectorProduct(Pool& pool, const SparseArray<T>& a, const TensorTypedView<T>& x, unsigned chunkCount) {
+			auto [rows, cols] = matrixDimensions(a);
+			if (x.size() != cols) {
+				ErrorManager::throwExceptionWithDebugInfo(ErrorName::DimensionsError, "Vector length does not match the number of matrix columns");
+			}
+			auto rowPtr = a.rowPointers();
+			auto colIdx = a.columnIndices();
+			auto values = a.explicitValues();
+			const T implicit = a.implicitValue();
+			const T implicitTerm = (implicit == T {}) ? T {} : implicit * std::accumulate(x.begin(), x.end(), T {});
+			Tensor<T> y(T {}, {rows});
+			const T* xData = x.data();
+			const T* vData = values.data();
+			const mint* cData = colIdx.data();
+			T* yData = y.data();
+			forEachRowChunk(pool, balancedRowPartition(rowPtr, chunkCount), [&](mint first, mint last, size_t) {
+				for (mint row = first; row < last; ++row) {
+					T sum = implicitTerm;
+					for (mint k = rowPtr[row]; k < rowPtr[row + 1]; ++k) {
+						sum += (vData[k] - implicit) * xData[cData[k] - 1];
+					}
+					yData[row] = sum;
+				}
+			});
+			return y;
+		}
+
+		/// Sparse matrix - dense matrix product, implicit * Total[b] is added to every row of the result
+		template<typename Pool, typename T>
+		Tensor<T> matrixMatrixProduct(Pool& pool, const SparseArray<T>& a, const TensorTypedView<T>& b, unsigned chunkCount) {
+			auto [rows, inner] = matrixDimensions(a);
+			if (b.getDimensions()[0] != inner) {
+				ErrorManager::throwExceptionWithDebugInfo(ErrorName::DimensionsError, "Dense matrix dimensions do not match the sparse matrix");
+			}
+			const mint cols = b.getDimensions()[1];
+			auto rowPtr = a.rowPointers();
+			auto colIdx = a.columnIndices();
+			auto values = a.explicitValues();
+			const T implicit = a.implicitValue();
+			const T* bData = b.data();
+
+			std::vector<T> implicitRow(static_cast<size_t>(cols), T {});
+			if (implicit != T {}) {
+				for (mint i = 0; i < inner; ++i) {
+					std::transform(implicitRow.begin(), implicitRow.end(), bData + i * cols, implicitRow.begin(), std::plus<>());
+				}
+				std::transform(implicitRow.begin(), implicitRow.end(), implicitRow.begin(), [implicit](T v) { return implicit * v; });
+			}
+
+			Tensor<T> c(T {}, {rows, cols});
+			const T* vData = values.data();
+			const mint* cData = colIdx.data();
+			T* outData = c.data();
+			forEachRowChunk(pool, balancedRowPartition(rowPtr, chunkCount), [&](mint first, mint last, size_t) {
+				for (mint row = first; row < last; ++row) {
+					T* out = outData + row * cols;
+					std::copy(implicitRow.begin(), implicitRow.end(), out);
+					for (mint k = rowPtr[row]; k < rowPtr[row + 1]; ++k) {
+						const T coeff = vData[k] - implicit;
+						const T* bRow = bData + (cData[k] - 1) * cols;
+						for (mint j = 0; j < cols; ++j) {
+							out[j] += coeff * bRow[j];
+						}
+					}
+				}
+			});
+			return c;
+		}
+	}  // namespace Detail
+	/// @endcond
+
+	/**
+	 * @brief   Product of a sparse matrix and a dense vector or matrix, computed in parallel
+	 * @tparam  Pool - thread pool type (e.g. LLU::ThreadPool or LLU::BasicPool)
+	 * @tparam  T - data type
+	 * @param   pool - thread pool to run on
+	 * @param   a - sparse matrix of dimensions {m, k}
+	 * @param   b - dense vector of length k or dense matrix of dimensions {k, n}
+	 * @param   chunkCount - number of chunks to split the work into, defaults to hardware concurrency
+	 * @return  new Tensor of length m or dimensions {m, n}, equal to Dot[a, b]
+	 * @throws  ErrorName::RankError - if \p a is not a matrix or \p b is neither a vector nor a matrix
+	 * @throws  ErrorName::DimensionsError - if dimensions of \p a and \p b are not compatible
+	 */
+	template<typename Pool, typename T>
+	Tensor<T> dot(Pool& pool, const SparseArray<T>& a, const TensorTypedView<typename SparseArray<T>::value_type>& b,
+				  unsigned chunkCount = Detail::defaultChunkCount()) {
+		switch (b.getRank()) {
+			case 1: return Detail::matrixVectorProduct(pool, a, b, chunkCount);
+			case 2: return Detail::matrixMatrixProduct(pool, a, b, chunkCount);
+			default:
+				ErrorManager::throwExceptionWithDebugInfo(ErrorName::RankError, "Sparse matrix can only be multiplied by a vector or a matrix");
+		}
+	}
+
+	/**
+	 * @brief   Transpose a sparse matrix
+	 * @tparam  Pool - thread pool type (e.g. LLU::ThreadPool or LLU::BasicPool)
+	 * @tparam  T - data type
+	 * @param   pool - thread pool to run on
+	 * @param   a - sparse matrix
+	 * @param   chunkCount - number of chunks to split the work into, defaults to hardware concurrency
+	 * @return  new SparseArray, owned by the library, with the same implicit value as \p a
+	 * @note    Explicit positions of the transpose are generated in parallel, the final CSR structure is built by LibraryLink.
+	 */
+	template<typename Pool, typename T>
+	SparseArray<T> transpose(Pool& pool, const SparseArray<T>& a, unsigned chunkCount = Detail::defaultChunkCount()) {
+		auto [rows, cols] = Detail::matrixDimensions(a);
+		auto rowPtr = a.rowPointers();
+		auto colIdx = a.columnIndices();
+		auto values = a.explicitValues();
+		const mint nnz = values.size();
+		Tensor<mint> positions(0, {nnz, 2});
+		mint* posData = positions.data();
+		const mint* cData = colIdx.data();
+		Detail::forEachRowChunk(pool, balancedRowPartition(rowPtr, chunkCount), [&](mint first, mint last, size_t) {
+			for (mint row = first; row < last; ++row) {
+				for (mint k = rowPtr[row]; k < rowPtr[row + 1]; ++k) {
+					posData[2 * k] = cData[k];
+					posData[2 * k + 1] = row + 1;
+				}
+			}
+		});
+		Tensor<T> transposedValues {values.begin(), values.end()};
+		return SparseArray<T> {positions, transposedValues, {cols, rows}, a.implicitValue()};
+	}
+
+	/**
+	 * @brief   Sum elements in each row of a sparse matrix, including implicit elements
+	 * @tparam  Pool - thread pool type (e.g. LLU::ThreadPool or LLU::BasicPool)
+	 * @tparam  T - data type
+	 * @param   pool - thread pool to run on
+	 * @param   a - sparse matrix of dimensions {m, n}
+	 * @param   chunkCount - number of chunks to split the work into, defaults to hardware concurrency
+	 * @return  new Tensor of length m, equal to Total[a, {2}]
+	 */
+	template<typename Pool, typename T>
+	Tensor<T> rowSums(Pool& pool, const SparseArray<T>& a, unsigned chunkCount = Detail::defaultChunkCount()) {
+		auto [rows, cols] = Detail::matrixDimensions(a);
+		auto rowPtr = a.rowPointers();
+		auto values = a.explicitValues();
+		const T implicit = a.implicitValue();
+		Tensor<T> res(T {}, {rows});
+		const T* vData = values.data();
+		T* out = res.data();
+		Detail::forEachRowChunk(pool, balancedRowPartition(rowPtr, chunkCount), [&](mint first, mint last, size_t) {
+			for (mint row = first; row < last; ++row) {
+				const mint explicitCount = rowPtr[row + 1] - rowPtr[row];
+				out[row] = std::accumulate(vData + rowPtr[row], vData + rowPtr[row + 1], T {}) + static_cast<T>(cols - explicitCount) * implicit;
+			}
+		});
+		return res;
+	}
+
+	/**
+	 * @brief   Sum elements in each column of a sparse matrix, including implicit elements
+	 * @tparam  Pool - thread pool type (e.g. LLU::ThreadPool or LLU::BasicPool)
+	 * @tparam  T - data type
+	 * @param   pool - thread pool to run on
+	 * @param   a - sparse matrix of dimensions {m, n}
+	 * @param   chunkCount - number of chunks to split the work into, defaults to hardware concurrency
+	 * @return  new Tensor of length n, equal to Total[a]
+	 * @note    Each chunk accumulates into its own buffer of length n, buffers are combined at the end.
+	 */
+	template<typename Pool, typename T>
+	Tensor<T> columnSums(Pool& pool, const SparseArray<T>& a, unsigned chunkCount = Detail::defaultChunkCount()) {
+		auto [rows, cols] = Detail::matrixDimensions(a);
+		auto rowPtr = a.rowPointers();
+		auto colIdx = a.columnIndices();
+		auto values = a.explicitValues();
+		const T implicit = a.implicitValue();
+		auto bounds = balancedRowPartition(rowPtr, chunkCount);
+		std::vector<std::vector<T>> partial(bounds.size() - 1);
+		std::vector<std::vector<mint>> partialCounts(bounds.size() - 1);
+		const T* vData = values.data();
+		const mint* cData = colIdx.data();
+		Detail::forEachRowChunk(pool, bounds, [&](mint first, mint last, size_t chunk) {
+			auto& sums = partial[chunk];
+			auto& counts = partialCounts[chunk];
+			sums.assign(static_cast<size_t>(cols), T {});
+			counts.assign(static_cast<size_t>(cols), 0);
+			for (mint k = rowPtr[first]; k < rowPtr[last]; ++k) {
+				sums[cData[k] - 1] += vData[k];
+				++counts[cData[k] - 1];
+			}
+		});
+		Tensor<T> res(T {}, {cols});
+		for (mint col = 0; col < cols; ++col) {
+			T sum {};
+			mint explicitCount = 0;
+			for (size_t chunk = 0; chunk < partial.size(); ++chunk) {
+				sum += partial[chunk][col];
+				explicitCount += partialCounts[chunk][col];
+			}
+			res[col] = sum + static_cast<T>(rows - explicitCount) * implicit;
+		}
+		return res;
+	}
+
+	/**
+	 * @brief   Reduce explicit elements in each row of a sparse matrix with a binary operation
+	 * @tparam  Pool - thread pool type (e.g. LLU::ThreadPool or LLU::BasicPool)
+	 * @tparam  T - data type
+	 * @tparam  BinaryOp - binary operation, callable as op(T, T) -> T
+	 * @param   pool - thread pool to run on
+	 * @param   a - sparse matrix of dimensions {m, n}
+	 * @param   init - initial value for each row
+	 * @param   op - binary operation
+	 * @param   chunkCount - number of chunks to split the work into, defaults to hardware concurrency
+	 * @return  new Tensor of length m
+	 * @note    Implicit elements are not visited, use rowSums if they must be taken into account.
+	 */
+	template<typename Pool, typename T, typename BinaryOp>
+	Tensor<T> reduceRows(Pool& pool, const SparseArray<T>& a, T init, BinaryOp op, unsigned chunkCount = Detail::defaultChunkCount()) {
+		auto [rows, cols] = Detail::matrixDimensions(a);
+		Unused(cols);
+		auto rowPtr = a.rowPointers();
+		auto values = a.explicitValues();
+		Tensor<T> res(init, {rows});
+		const T* vData = values.data();
+		T* out = res.data();
+		Detail::forEachRowChunk(pool, balancedRowPartition(rowPtr, chunkCount), [&](mint first, mint last, size_t) {
+			for (mint row = first; row < last; ++row) {
+				out[row] = std::accumulate(vData + rowPtr[row], vData + rowPtr[row + 1], init, op);
+			}
+		});
+		return res;
+	}
+
+}  // namespace LLU::Sparse
+
+#endif	  // LLU_CONTAINERS_SPARSEKERNELS_HPP
@@ -10,6 +10,7 @@
 #include "LLU/Containers/Interfaces.h"
 #include "LLU/Containers/Iterators/IterableContainer.hpp"
 #include "LLU/ErrorLog/ErrorManager.h"
+#include "LLU/TypeDispatch.hpp"
 
 namespace LLU {
 
@@ -149,29 +150,27 @@ namespace LLU {
 
 	/**
 	 * Take a Image-like object \p img and a function \p callable and call the function with a ImageTypedView created from \p img
+	 * @tparam  Types - TypeList of data types for which \p callable will be instantiated, types not supported by Image are skipped
 	 * @tparam  ImageT - a Image-like type (GenericImage, ImageView or MNumericAray)
 	 * @tparam  F - any callable object
 	 * @param   img - Image-like object on which an operation will be performed
-	 * @param   callable - a callable object that can be called with a ImageTypedView of any type
+	 * @param   callable - a callable object that can be called with a ImageTypedView of any type from \p Types
 	 * @return  result of calling \p callable on a ImageTypedView over \p img
+	 * @throws  ErrorName::ImageTypeError - if the data type of \p img is not in \p Types
 	 */
-	template<typename ImageT, typename F>
+	template<typename Types = ImageTypes, typename ImageT, typename F>
 	auto asTypedImage(ImageT&& img, F&& callable) {
-		switch (img.type()) {
-			case MImage_Type_Bit: return std::forward<F>(callable)(ImageTypedView<std::int8_t>(std::forward<ImageT>(img)));
-			case MImage_Type_Bit8: return std::forward<F>(callable)(ImageTypedView<std::uint8_t>(std::forward<ImageT>(img)));
-			case MImage_Type_Bit16: return std::forward<F>(callable)(ImageTypedView<std::uint16_t>(std::forward<ImageT>(img)));
-			case MImage_Type_Real32: return std::forward<F>(callable)(ImageTypedView<float>(std::forward<ImageT>(img)));
-			case MImage_Type_Real: return std::forward<F>(callable)(ImageTypedView<double>(std::forward<ImageT>(img)));
-			default: ErrorManager::throwException(ErrorName::ImageTypeError);
-		}
+		return dispatchType<TypeListIntersection<Types, ImageTypes>, ImageTypeCodes>(img.type(), ErrorName::ImageTypeError, [&](auto tag) {
+			using T = typename decltype(tag)::type;
+			return std::forward<F>(callable)(ImageTypedView<T>(std::forward<ImageT>(img)));
+		});
 	}
 
 	/// @cond
 	// Specialization of asTypedImage for MImage
-	template<typename F>
+	template<typename Types = ImageTypes, typename F>
 	auto asTypedImage(MImage img, F&& callable) {
-		return asTypedImage(ImageView {img}, std::forward<F>(callable));
+		return asTypedImage<Types>(ImageView {img}, std::forward<F>(callable));
 	}
 	/// @endcond
 }  // namespace LLU
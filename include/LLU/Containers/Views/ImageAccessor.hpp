@@ -0,0 +1,189 @@
+/**
+ * @file
+ * @brief   Definition and implementation of ImageAccessor - fast, layout-aware access to pixels of an image.
+ */
+#ifndef LLU_CONTAINERS_VIEWS_IMAGEACCESSOR_HPP
+#define LLU_CONTAINERS_VIEWS_IMAGEACCESSOR_HPP
+
+#include "LLU/Containers/Interfaces.h"
+#include "LLU/Containers/Iterators/Strided.hpp"
+#include "LLU/ErrorLog/ErrorManager.h"
+#include "LLU/Utilities.hpp"
+
+namespace LLU {
+
+	/**
+	 * @brief   Non-owning accessor to channel values of an image, computed directly from the raw data pointer and cached strides.
+	 *
+	 * TypedImage::get and TypedImage::set call into LibraryLink for every single value, which is prohibitively slow when the whole image
+	 * is processed. ImageAccessor queries image properties once, on construction, and afterwards resolves every access with plain
+	 * pointer arithmetic. Both interleaved (channels of a pixel adjacent in memory) and planar (each channel stored as a separate plane)
+	 * layouts are supported and the accessor interface is identical for both of them.
+	 *
+	 * Contrary to TypedImage::get, all indices are 0-based and are not checked. The accessor is only valid as long as the underlying MImage
+	 * is alive, and it must not be used after the image has been reallocated.
+	 *
+	 * @tparam  T - type of image data, must match the actual image type (use const T for read-only access)
+	 */
+	template<typename T>
+	class ImageAccessor {
+	public:
+		/// Type of channel values
+		using value_type = std::remove_cv_t<T>;
+
+		/// Range over values of one channel in a row, in a 2D plane, or in the whole image
+		using range_type = StridedRange<T>;
+
+		ImageAccessor() = default;
+
+		/**
+		 * @brief   Create an accessor for given image
+		 * @param   im - an image, this can be for instance Image<T>, GenericImage or ImageView
+		 * @throws  ErrorName::ImageTypeError - if the actual datatype of \p im is not T
+		 */
+		explicit ImageAccessor(const ImageInterface& im)
+			: data {static_cast<T*>(im.rawData())}, sliceCount {im.is3D() ? im.slices() : 1}, rowCount {im.rows()}, colCount {im.columns()},
+			  channelCount {im.channels()}, interleaved {im.interleavedQ()} {
+			if (ImageType<value_type> != im.type()) {
+				ErrorManager::throwException(ErrorName::ImageTypeError);
+			}
+			if (interleaved) {
+				colStride = channelCount;
+				rowStride = colCount * channelCount;
+				sliceStride = rowCount * rowStride;
+				channelStride = 1;
+			} else {
+				colStride = 1;
+				rowStride = colCount;
+				sliceStride = rowCount * colCount;
+				channelStride = sliceCount * sliceStride;
+			}
+		}
+
+		/**
+		 * @brief   Get reference to channel value of a pixel in a 2D image (or in the first slice of a 3D image)
+		 * @param   row - pixel row, 0-based
+		 * @param   col - pixel column, 0-based
+		 * @param   channel - channel index, 0-based
+		 */
+		T& operator()(mint row, mint col, mint channel) const noexcept {
+			return data[row * rowStride + col * colStride + channel * channelStride];
+		}
+
+		/**
+		 * @brief   Get reference to channel value of a pixel in a 3D image
+		 * @param   slice - slice index, 0-based
+		 * @param   row - pixel row, 0-based
+		 * @param   col - pixel column, 0-based
+		 * @param   channel - channel index, 0-based
+		 */
+		T& operator()(mint slice, mint row, mint col, mint channel) const noexcept {
+			return data[slice * sliceStride + row * rowStride + col * colStride + channel * channelStride];
+		}
+
+		/**
+		 * @brief   Get a range over values of one channel in a single row of the image
+		 * @param   rowIndex - row index, 0-based
+		 * @param   channelIndex - channel index, 0-based
+		 * @param   sliceIndex - slice index, 0-based, only meaningful for 3D images
+		 * @return  range of columns() elements
+		 */
+		range_type row(mint rowIndex, mint channelIndex, mint sliceIndex = 0) const noexcept {
+			return {&(*this)(sliceIndex, rowIndex, 0, channelIndex), colCount, colStride};
+		}
+
+		/**
+		 * @brief   Get a range over values of one channel in a single 2D plane (one slice) of the image, in row-major order
+		 * @param   channelIndex - channel index, 0-based
+		 * @param   sliceIndex - slice index, 0-based, only meaningful for 3D images
+		 * @return  range of rows() * columns() elements
+		 */
+		range_type plane(mint channelIndex, mint sliceIndex = 0) const noexcept {
+			return {&(*this)(sliceIndex, 0, 0, channelIndex), rowCount * colCount, colStride};
+		}
+
+		/**
+		 * @brief   Get a range over values of one channel in the whole image, slice by slice, in row-major order
+		 * @param   channelIndex - channel index, 0-based
+		 * @return  range of slices() * rows() * columns() elements, contiguous for planar images
+		 */
+		range_type channel(mint channelIndex) const noexcept {
+			return {data + channelIndex * channelStride, sliceCount * rowCount * colCount, colStride};
+		}
+
+		/**
+		 * @brief   Get pointer to the first channel value of given pixel. For interleaved images the remaining channels follow immediately.
+		 * @param   row - pixel row, 0-based
+		 * @param   col - pixel column, 0-based
+		 * @param   slice - slice index, 0-based, only meaningful for 3D images
+		 */
+		T* pixel(mint row, mint col, mint slice = 0) const noexcept {
+			return &(*this)(slice, row, col, 0);
+		}
+
+		/// Get raw pointer to image data
+		T* rawData() const noexcept {
+			return data;
+		}
+
+		/// Get number of slices, 1 for 2D images
+		mint slices() const noexcept {
+			return sliceCount;
+		}
+
+		/// Get number of rows
+		mint rows() const noexcept {
+			return rowCount;
+		}
+
+		/// Get number of columns
+		mint columns() const noexcept {
+			return colCount;
+		}
+
+		/// Get number of channels
+		mint channels() const noexcept {
+			return channelCount;
+		}
+
+		/// Check if the image is interleaved
+		bool interleavedQ() const noexcept {
+			return interleaved;
+		}
+
+		/// Get distance (in elements) between consecutive values of a channel in a row
+		mint getColumnStride() const noexcept {
+			return colStride;
+		}
+
+		/// Get distance (in elements) between consecutive rows of a channel
+		mint getRowStride() const noexcept {
+			return rowStride;
+		}
+
+		/// Get distance (in elements) between consecutive slices of a channel
+		mint getSliceStride() const noexcept {
+			return sliceStride;
+		}
+
+		/// Get distance (in elements) between values of consecutive channels of a pixel
+		mint getChannelStride() const noexcept {
+			return channelStride;
+		}
+
+	private:
+		T* data = nullptr;
+		mint sliceCount = 0;
+		mint rowCount = 0;
+		mint colCount = 0;
+		mint channelCount = 0;
+		bool interleaved = true;
+		mint colStride = 0;
+		mint rowStride = 0;
+		mint sliceStride = 0;
+		mint channelStride = 0;
+	};
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_VIEWS_IMAGEACCESSOR_HPP
@@ -9,6 +9,7 @@
 #include "LLU/Containers/Generic/NumericArray.hpp"
 #include "LLU/Containers/Interfaces.h"
 #include "LLU/Containers/Iterators/IterableContainer.hpp"
+#include "LLU/TypeDispatch.hpp"
 
 namespace LLU {
 
@@ -119,38 +120,28 @@ namespace LLU {
 
 	/**
 	 * Take a NumericArray-like object \p na and a function \p callable and call the function with a NumericArrayTypedView created from \p na
+	 * @tparam  Types - TypeList of data types for which \p callable will be instantiated, types not supported by NumericArray are skipped
 	 * @tparam  NumericArrayT - a NumericArray-like type (GenericNumericArray, NumericArrayView or MNumericAray)
 	 * @tparam  F - any callable object
 	 * @param   na - NumericArray-like object on which an operation will be performed
-	 * @param   callable - a callable object that can be called with a NumericArrayTypedView of any type
+	 * @param   callable - a callable object that can be called with a NumericArrayTypedView of any type from \p Types
 	 * @return  result of calling \p callable on a NumericArrayTypedView over \p na
+	 * @throws  ErrorName::NumericArrayTypeError - if the data type of \p na is not in \p Types
 	 */
-	template<typename NumericArrayT, typename F>
+	template<typename Types = NumericArrayTypes, typename NumericArrayT, typename F>
 	auto asTypedNumericArray(NumericArrayT&& na, F&& callable) {
-		switch (na.type()) {
-			case MNumericArray_Type_Bit8: return std::forward<F>(callable)(NumericArrayTypedView<std::int8_t> {std::forward<NumericArrayT>(na)});
-			case MNumericArray_Type_UBit8: return std::forward<F>(callable)(NumericArrayTypedView<std::uint8_t> {std::forward<NumericArrayT>(na)});
-			case MNumericArray_Type_Bit16: return std::forward<F>(callable)(NumericArrayTypedView<std::int16_t> {std::forward<NumericArrayT>(na)});
-			case MNumericArray_Type_UBit16: return std::forward<F>(callable)(NumericArrayTypedView<std::uint16_t> {std::forward<NumericArrayT>(na)});
-			case MNumericArray_Type_Bit32: return std::forward<F>(callable)(NumericArrayTypedView<std::int32_t> {std::forward<NumericArrayT>(na)});
-			case MNumericArray_Type_UBit32: return std::forward<F>(callable)(NumericArrayTypedView<std::uint32_t> {std::forward<NumericArrayT>(na)});
-			case MNumericArray_Type_Bit64: return std::forward<F>(callable)(NumericArrayTypedView<std::int64_t> {std::forward<NumericArrayT>(na)});
-			case MNumericArray_Type_UBit64: return std::forward<F>(callable)(NumericArrayTypedView<std::uint64_t> {std::forward<NumericArrayT>(na)});
-			case MNumericArray_Type_Real32: return std::forward<F>(callable)(NumericArrayTypedView<float> {std::forward<NumericArrayT>(na)});
-			case MNumericArray_Type_Real64: return std::forward<F>(callable)(NumericArrayTypedView<double> {std::forward<NumericArrayT>(na)});
-			case MNumericArray_Type_Complex_Real32:
-				return std::forward<F>(callable)(NumericArrayTypedView<std::complex<float>> {std::forward<NumericArrayT>(na)});
-			case MNumericArray_Type_Complex_Real64:
-				return std::forward<F>(callable)(NumericArrayTypedView<std::complex<double>> {std::forward<NumericArrayT>(na)});
-			default: ErrorManager::throwException(ErrorName::NumericArrayTypeError);
-		}
+		return dispatchType<TypeListIntersection<Types, NumericArrayTypes>, NumericArrayTypeCodes>(
+			na.type(), ErrorName::NumericArrayTypeError, [&](auto tag) {
+				using T = typename decltype(tag)::type;
+				return std::forward<F>(callable)(NumericArrayTypedView<T> {std::forward<NumericArrayT>(na)});
+			});
 	}
 
 	/// @cond
 	// Specialization of asTypedNumericArray for MNumericArray
-	template<typename F>
+	template<typename Types = NumericArrayTypes, typename F>
 	auto asTypedNumericArray(MNumericArray na, F&& callable) {
-		return asTypedNumericArray(NumericArrayView {na}, std::forward<F>(callable));
+		return asTypedNumericArray<Types>(NumericArrayView {na}, std::forward<F>(callable));
 	}
 	/// @endcond
 }  // namespace LLU
@@ -9,6 +9,7 @@
 #include "LLU/Containers/Generic/Tensor.hpp"
 #include "LLU/Containers/Interfaces.h"
 #include "LLU/Containers/Iterators/IterableContainer.hpp"
+#include "LLU/TypeDispatch.hpp"
 
 namespace LLU {
 
@@ -118,27 +119,27 @@ namespace LLU {
 
 	/**
 	 * Take a Tensor-like object \p t and a function \p callable and call the function with a TensorTypedView created from \p t
+	 * @tparam  Types - TypeList of data types for which \p callable will be instantiated, types not supported by Tensor are skipped
 	 * @tparam  TensorT - a Tensor-like type (GenericTensor, TensorView or MNumericAray)
 	 * @tparam  F - any callable object
 	 * @param   t - Tensor-like object on which an operation will be performed
-	 * @param   callable - a callable object that can be called with a TensorTypedView of any type
+	 * @param   callable - a callable object that can be called with a TensorTypedView of any type from \p Types
 	 * @return  result of calling \p callable on a TensorTypedView over \p t
+	 * @throws  ErrorName::TensorTypeError - if the data type of \p t is not in \p Types
 	 */
-	template<typename TensorT, typename F>
+	template<typename Types = TensorTypes, typename TensorT, typename F>
 	auto asTypedTensor(TensorT&& t, F&& callable) {
-		switch (t.type()) {
-			case MType_Integer: return std::forward<F>(callable)(TensorTypedView<mint> {std::forward<TensorT>(t)});
-			case MType_Real: return std::forward<F>(callable)(TensorTypedView<double> {std::forward<TensorT>(t)});
-			case MType_Complex: return std::forward<F>(callable)(TensorTypedView<std::complex<double>> {std::forward<TensorT>(t)});
-			default: ErrorManager::throwException(ErrorName::TensorTypeError);
-		}
+		return dispatchType<TypeListIntersection<Types, TensorTypes>, TensorTypeCodes>(t.type(), ErrorName::TensorTypeError, [&](auto tag) {
+			using T = typename decltype(tag)::type;
+			return std::forward<F>(callable)(TensorTypedView<T> {std::forward<TensorT>(t)});
+		});
 	}
 
 	/// @cond
 	// Specialization of asTypedTensor for MTensor
-	template<typename F>
+	template<typename Types = TensorTypes, typename F>
 	auto asTypedTensor(MTensor t, F&& callable) {
-		return asTypedTensor(TensorView {t}, std::forward<F>(callable));
+		return asTypedTensor<Types>(TensorView {t}, std::forward<F>(callable));
 	}
 	/// @endcond
 }  // namespace LLU
@@ -78,6 +78,15 @@ namespace LLU {
 		extern const std::string ImageSizeError;	 ///< wrong assumption about Image size
 		extern const std::string ImageIndexError;	 ///< trying to access non-existing element
 
+		// MSparseArray errors:
+		extern const std::string SparseArrayCloneError;					///< MSparseArray cloning failed
+		extern const std::string SparseArrayTypeError;					///< SparseArray type mismatch
+		extern const std::string SparseArrayFromPositionsError;			///< creating MSparseArray from explicit positions failed
+		extern const std::string SparseArrayFromTensorError;			///< creating MSparseArray from dense MTensor failed
+		extern const std::string SparseArrayImplicitValueResetError;	///< changing the implicit value of MSparseArray failed
+		extern const std::string SparseArrayExplicitPositionsError;		///< getting explicit positions of MSparseArray failed
+		extern const std::string SparseArrayToTensorError;				///< converting MSparseArray to dense MTensor failed
+
 		// General container errors:
 		extern const std::string CreateFromNullError;		   ///< attempting to create a generic container from nullptr
 		extern const std::string MArrayElementIndexError;	   ///< attempting to access MArray element at invalid index
@@ -112,6 +121,8 @@ namespace LLU {
 		extern const std::string DLGetNodeDataError;	 ///< DataStoreNode_getData failed
 		extern const std::string DLSharedDataStore;	 	 ///< Trying to create a Shared DataStore. DataStore can only be passed as Automatic or Manual.
 		extern const std::string DLPushBackTypeError;	 ///< Element to be added to the DataList has incorrect type
+		extern const std::string DLIndexError;			 ///< Trying to access non-existing DataList node
+		extern const std::string DLMissingNode;			 ///< DataList has no node with the name of a field of the decoded struct
 
 		// MArgument errors:
 		extern const std::string ArgumentCreateNull;		  ///< Trying to create PrimitiveWrapper object from nullptr
@@ -129,6 +140,12 @@ namespace LLU {
 		extern const std::string PathNotValidated;		///< Given file path could not be validated under desired open mode
 		extern const std::string InvalidOpenMode;		///< Specified open mode is invalid
 		extern const std::string OpenFileFailed;		///< Could not open file
+		extern const std::string MapFileFailed;			///< Could not map file into memory
+		extern const std::string InvalidArrayFileHeader;	///< File does not start with a valid array header
+		extern const std::string ReadFileFailed;		///< Could not read from file
+		extern const std::string WriteFileFailed;		///< Could not write to file
+		extern const std::string ChecksumMismatch;		///< Data read from file does not match the stored checksum
+		extern const std::string DecompressionFailed;	///< Compressed data is corrupted
 	}  // namespace ErrorName
 
 }  // namespace LLU
@@ -7,6 +7,8 @@
 #define LLU_FILEUTILITIES_H
 
 #include <codecvt>
+#include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <fstream>
 #include <ios>
@@ -171,6 +173,37 @@ namespace LLU {
 	 * @throw   ErrorName::OpenFileFailed if the file could not be opened
 	 */
 	std::fstream openFileStream(const std::string& fileName, std::ios::openmode mode, const SharePolicy& shp = AlwaysReadExclusiveWrite {});
+
+	/**
+	 * Read bytes from given position in a file without moving the file position indicator (pread on POSIX systems).
+	 * Unlike fread, this function can be called concurrently from many threads on the same file.
+	 * @param   file - file opened for reading, e.g. with openFile
+	 * @param   buffer - memory for at least \p count bytes
+	 * @param   count - number of bytes to read
+	 * @param   offset - position in the file of the first byte to read
+	 * @return  number of bytes read, smaller than \p count only if the end of file was reached
+	 * @throw   ErrorName::ReadFileFailed if reading failed
+	 */
+	std::size_t readAt(std::FILE* file, void* buffer, std::size_t count, std::uint64_t offset);
+
+	/**
+	 * Write bytes at given position in a file without moving the file position indicator (pwrite on POSIX systems).
+	 * Unlike fwrite, this function can be called concurrently from many threads on the same file.
+	 * @param   file - file opened for writing, e.g. with openFile
+	 * @param   buffer - \p count bytes to write
+	 * @param   count - number of bytes to write
+	 * @param   offset - position in the file of the first byte to write
+	 * @throw   ErrorName::WriteFileFailed if not all bytes could be written
+	 */
+	void writeAt(std::FILE* file, const void* buffer, std::size_t count, std::uint64_t offset);
+
+	/**
+	 * Get the size of an open file in bytes.
+	 * @param   file - open file, e.g. with openFile
+	 * @return  number of bytes in the file
+	 * @throw   ErrorName::ReadFileFailed if the size could not be determined
+	 */
+	std::uint64_t fileSize(std::FILE* file);
 } // namespace LLU
 
 #endif	  // LLU_FILEUTILITIES_H
@@ -11,11 +11,15 @@
 
 /* Containers */
 #include "LLU/Containers/DataList.h"
+#include "LLU/Containers/Dispatch.hpp"
 #include "LLU/Containers/Image.h"
 #include "LLU/Containers/NumericArray.h"
+#include "LLU/Containers/SparseArray.h"
 #include "LLU/Containers/Tensor.h"
 #include "LLU/Containers/Views/Image.hpp"
+#include "LLU/Containers/Views/ImageAccessor.hpp"
 #include "LLU/Containers/Views/NumericArray.hpp"
+#include "LLU/Containers/Views/Tensor.hpp"
 
 /* Error reporting */
 #include "LLU/ErrorLog/ErrorManager.h"
@@ -21,12 +21,14 @@
 #include "LLU/Containers/DataList.h"
 #include "LLU/Containers/Image.h"
 #include "LLU/Containers/NumericArray.h"
+#include "LLU/Containers/SparseArray.h"
 #include "LLU/Containers/Tensor.h"
 #include "LLU/ErrorLog/ErrorManager.h"
 #include "LLU/LibraryData.h"
 #include "LLU/MArgument.h"
 #include "LLU/ManagedExpression.hpp"
 #include "LLU/ProgressMonitor.h"
+#include "LLU/TypeDispatch.hpp"
 
 namespace LLU {
 
@@ -212,16 +214,46 @@ namespace LLU {
 		 **/
 		MImage getMImage(size_type index) const;
 
+		/**
+		 *   @brief         Get MArgument of type MSparseArray at position \p index and wrap it into SparseArray object
+		 *   @tparam		T - type of data stored in SparseArray
+		 *   @param[in]     index - position of desired MArgument in \c Args
+		 *   @returns       SparseArray wrapper of MArgument at position \c index
+		 *   @throws        ErrorName::MArgumentIndexError - if \c index is out-of-bounds
+		 *   @see			SparseArray<T>::SparseArray(MSparseArray, Ownership);
+		 **/
+		template<typename T, Passing Mode = Passing::Automatic>
+		SparseArray<T> getSparseArray(size_type index) const;
+
+		/**
+		 *	@brief		Get MArgument of type MSparseArray at position \p index and wrap it into generic MContainer wrapper
+		 * 	@tparam 	Mode - passing mode to be used
+		 * 	@param 		index - position of desired MArgument in \c Args
+		 * 	@return		MContainer wrapper of MSparseArray with given passing mode
+		 */
+		template<Passing Mode = Passing::Automatic>
+		GenericSparseArray getGenericSparseArray(size_type index) const;
+
+		/**
+		 *   @brief         Get MArgument of type MSparseArray at position \c index.
+		 *   @warning       Use of this function is discouraged. Use getSparseArray instead, if possible.
+		 *   @param[in]     index - position of desired MArgument in \c Args
+		 *   @returns       MSparseArray of MArgument at position \c index
+		 *   @throws        ErrorName::MArgumentIndexError - if \c index is out-of-bounds
+		 **/
+		MSparseArray getMSparseArray(size_type index) const;
+
 		/**
 		 *   @brief         Get DataStore with all nodes of the same type from MArgument at position \c index
 		 *   @tparam		T - type of data stored in each node of DataStore, it T is MArgumentType::MArgument it will accept any node
 		 *   @param[in]     index - position of desired MArgument in \c Args
+		 *   @param[in]     validation - when to check the types of DataStore nodes, by default all nodes are checked immediately
 		 *   @returns       DataList wrapper of MArgument at position \c index
 		 *   @throws        ErrorName::MArgumentIndexError - if \c index is out-of-bounds
-		 *   @see			DataList<T>::DataList(DataStore ds);
+		 *   @see			DataList<T>::DataList(GenericDataList gds, DataListValidation validation);
 		 **/
 		template<typename T, Passing Mode = Passing::Automatic>
-		DataList<T> getDataList(size_type index) const;
+		DataList<T> getDataList(size_type index, DataListValidation validation = DataListValidation::Eager) const;
 
 		/**
 		 *	@brief		Get MArgument of type DataStore at position \p index and wrap it into generic MContainer wrapper
@@ -430,6 +462,14 @@ namespace LLU {
 		 **/
 		void setDataStore(DataStore ds);
 
+		/**
+		 *   @brief         Set MSparseArray wrapped by \c sa as output MArgument
+		 *   @tparam		T - SparseArray data type
+		 *   @param[in]     sa - reference to SparseArray which should pass its internal MSparseArray to LibraryLink
+		 **/
+		template<typename T>
+		void setSparseArray(const SparseArray<T>& sa);
+
 		/**
 		 *   @brief         Set MSparseArray as output MArgument
 		 *   @param[in]     sa - MSparseArray to be passed to LibraryLink
@@ -515,6 +555,20 @@ namespace LLU {
 			im.pass(res);
 		}
 
+		/// @copydoc setSparseArray
+		template<typename T>
+		void set(const SparseArray<T>& sa) {
+			setSparseArray(sa);
+		}
+
+		/**
+		 *  Set MSparseArray wrapped by \c sa as output MArgument
+		 *  @param[in]  sa - reference to generic SparseArray which should pass its internal MSparseArray to LibraryLink
+		 */
+		void set(const GenericSparseArray& sa) {
+			sa.pass(res);
+		}
+
 		/// @copydoc setDataList
 		template<typename T>
 		void set(const DataList<T>& ds) {
@@ -581,6 +635,20 @@ namespace LLU {
 		template<Passing Mode = Passing::Automatic, class Operator>
 		void operateOnNumericArray(size_type index, Operator&& op);
 
+		/**
+		 *   @brief         Perform operation on NumericArray created from MNumericArray argument at position \p index in \c Args, instantiating \p op only for
+		 *                  data types from given list
+		 *   @tparam		Types - TypeList of accepted data types, e.g. FloatingTypes
+		 *   @tparam		Mode - passing mode of the NumericArray that will be processed
+		 *   @tparam		Operator - any callable class
+		 *   @param[in]     index - position of MNumericArray in \c Args
+		 *   @param[in]     op - callable object (possibly lambda) that takes only one argument - a NumericArray
+		 *   @throws        ErrorName::MArgumentIndexError - if \c index is out-of-bounds
+		 *   @throws        ErrorName::MArgumentNumericArrayError - if MNumericArray argument has a type that is not in \p Types
+		 **/
+		template<typename Types, Passing Mode = Passing::Automatic, class Operator>
+		void operateOnNumericArray(size_type index, Operator&& op);
+
 		/**
 		 *   @brief         Get type of MTensor at position \c index in \c Args
 		 *   @param[in]     index - position of desired MArgument in \c Args
@@ -615,6 +683,20 @@ namespace LLU {
 		template<Passing Mode = Passing::Automatic, class Operator>
 		void operateOnTensor(size_type index, Operator&& op);
 
+		/**
+		 *   @brief         Perform operation on Tensor created from MTensor argument at position \p index in \c Args, instantiating \p op only for
+		 *                  data types from given list
+		 *   @tparam		Types - TypeList of accepted data types, e.g. FloatingTypes
+		 *   @tparam		Mode - passing mode of the Tensor that will be processed
+		 *   @tparam		Operator - any callable class
+		 *   @param[in]     index - position of MTensor in \c Args
+		 *   @param[in]     op - callable object (possibly lambda) that takes only one argument - a Tensor
+		 *   @throws        ErrorName::MArgumentIndexError - if \c index is out-of-bounds
+		 *   @throws        ErrorName::MArgumentTensorError - if MTensor argument has a type that is not in \p Types
+		 **/
+		template<typename Types, Passing Mode = Passing::Automatic, class Operator>
+		void operateOnTensor(size_type index, Operator&& op);
+
 		/**
 		 *   @brief         Get type of MImage at position \c index in \c Args
 		 *   @param[in]     index - position of desired MArgument in \c Args
@@ -649,6 +731,20 @@ namespace LLU {
 		template<Passing Mode = Passing::Automatic, class Operator>
 		void operateOnImage(size_type index, Operator&& op);
 
+		/**
+		 *   @brief         Perform operation on Image created from MImage argument at position \p index in \c Args, instantiating \p op only for
+		 *                  data types from given list
+		 *   @tparam		Types - TypeList of accepted data types, e.g. FloatingTypes
+		 *   @tparam		Mode - passing mode of the Image that will be processed
+		 *   @tparam		Operator - any callable class
+		 *   @param[in]     index - position of MImage in \c Args
+		 *   @param[in]     op - callable object (possibly lambda) that takes only one argument - an Image
+		 *   @throws        ErrorName::MArgumentIndexError - if \c index is out-of-bounds
+		 *   @throws        ErrorName::MArgumentImageError - if MImage argument has a type that is not in \p Types
+		 **/
+		template<typename Types, Passing Mode = Passing::Automatic, class Operator>
+		void operateOnImage(size_type index, Operator&& op);
+
 		/************************************ User-defined types registration ************************************/
 
 		/**
@@ -877,6 +973,7 @@ namespace LLU {
 	LLU_MARGUMENTMANAGER_GENERATE_GET_SPECIALIZATION_FOR_CONTAINER(NumericArray)
 	LLU_MARGUMENTMANAGER_GENERATE_GET_SPECIALIZATION_FOR_CONTAINER(Tensor)
 	LLU_MARGUMENTMANAGER_GENERATE_GET_SPECIALIZATION_FOR_CONTAINER(Image)
+	LLU_MARGUMENTMANAGER_GENERATE_GET_SPECIALIZATION_FOR_CONTAINER(SparseArray)
 	LLU_MARGUMENTMANAGER_GENERATE_GET_SPECIALIZATION_FOR_CONTAINER(DataList)
 
 #undef LLU_MARGUMENTMANAGER_GENERATE_GET_SPECIALIZATION_FOR_CONTAINER
@@ -908,44 +1005,25 @@ namespace LLU {
 	template<Passing Mode, class Operator, class... Args>
 	void MArgumentManager::operateOnNumericArray(size_type index, Args&&... opArgs) {
 		Operator op;
-		switch (getNumericArrayType(index)) {
-			case MNumericArray_Type_Bit8: op(this->getNumericArray<int8_t, Mode>(index), std::forward<Args>(opArgs)...); break;
-			case MNumericArray_Type_UBit8: op(this->getNumericArray<uint8_t, Mode>(index), std::forward<Args>(opArgs)...); break;
-			case MNumericArray_Type_Bit16: op(this->getNumericArray<int16_t, Mode>(index), std::forward<Args>(opArgs)...); break;
-			case MNumericArray_Type_UBit16: op(this->getNumericArray<uint16_t, Mode>(index), std::forward<Args>(opArgs)...); break;
-			case MNumericArray_Type_Bit32: op(this->getNumericArray<int32_t, Mode>(index), std::forward<Args>(opArgs)...); break;
-			case MNumericArray_Type_UBit32: op(this->getNumericArray<uint32_t, Mode>(index), std::forward<Args>(opArgs)...); break;
-			case MNumericArray_Type_Bit64: op(this->getNumericArray<int64_t, Mode>(index), std::forward<Args>(opArgs)...); break;
-			case MNumericArray_Type_UBit64: op(this->getNumericArray<uint64_t, Mode>(index), std::forward<Args>(opArgs)...); break;
-			case MNumericArray_Type_Real32: op(this->getNumericArray<float, Mode>(index), std::forward<Args>(opArgs)...); break;
-			case MNumericArray_Type_Real64: op(this->getNumericArray<double, Mode>(index), std::forward<Args>(opArgs)...); break;
-			case MNumericArray_Type_Complex_Real32: op(this->getNumericArray<std::complex<float>, Mode>(index), std::forward<Args>(opArgs)...); break;
-			case MNumericArray_Type_Complex_Real64: op(this->getNumericArray<std::complex<double>, Mode>(index), std::forward<Args>(opArgs)...); break;
-			default:
-				ErrorManager::throwExceptionWithDebugInfo(ErrorName::MArgumentNumericArrayError,
-														  "Incorrect type of NumericArray argument. Argument index: " + std::to_string(index));
-		}
+		operateOnNumericArray<NumericArrayTypes, Mode>(index, [&](auto&& container) {
+			op(std::forward<decltype(container)>(container), std::forward<Args>(opArgs)...);
+		});
 	}
 
 	template<Passing Mode, class Operator>
 	void MArgumentManager::operateOnNumericArray(size_type index, Operator&& op) {
-		switch (getNumericArrayType(index)) {
-			case MNumericArray_Type_Bit8: op(this->getNumericArray<int8_t, Mode>(index)); break;
-			case MNumericArray_Type_UBit8: op(this->getNumericArray<uint8_t, Mode>(index)); break;
-			case MNumericArray_Type_Bit16: op(this->getNumericArray<int16_t, Mode>(index)); break;
-			case MNumericArray_Type_UBit16: op(this->getNumericArray<uint16_t, Mode>(index)); break;
-			case MNumericArray_Type_Bit32: op(this->getNumericArray<int32_t, Mode>(index)); break;
-			case MNumericArray_Type_UBit32: op(this->getNumericArray<uint32_t, Mode>(index)); break;
-			case MNumericArray_Type_Bit64: op(this->getNumericArray<int64_t, Mode>(index)); break;
-			case MNumericArray_Type_UBit64: op(this->getNumericArray<uint64_t, Mode>(index)); break;
-			case MNumericArray_Type_Real32: op(this->getNumericArray<float, Mode>(index)); break;
-			case MNumericArray_Type_Real64: op(this->getNumericArray<double, Mode>(index)); break;
-			case MNumericArray_Type_Complex_Real32: op(this->getNumericArray<std::complex<float>, Mode>(index)); break;
-			case MNumericArray_Type_Complex_Real64: op(this->getNumericArray<std::complex<double>, Mode>(index)); break;
-			default:
-				ErrorManager::throwExceptionWithDebugInfo(ErrorName::MArgumentNumericArrayError,
-														  "Incorrect type of NumericArray argument. Argument index: " + std::to_string(index));
-		}
+		operateOnNumericArray<NumericArrayTypes, Mode>(index, std::forward<Operator>(op));
+	}
+
+	template<typename Types, Passing Mode, class Operator>
+	void MArgumentManager::operateOnNumericArray(size_type index, Operator&& op) {
+		Detail::dispatchType<NumericArrayTypeCodes>(
+			TypeListIntersection<Types, NumericArrayTypes> {}, getNumericArrayType(index),
+			[&](auto tag) {
+				using T = typename decltype(tag)::type;
+				op(this->getNumericArray<T, Mode>(index));
+			},
+			ErrorName::MArgumentNumericArrayError, [index] { return "Incorrect type of NumericArray argument. Argument index: " + std::to_string(index); });
 	}
 
 	template<typename T, Passing Mode>
@@ -961,26 +1039,25 @@ namespace LLU {
 	template<Passing Mode, class Operator, class... Args>
 	void MArgumentManager::operateOnTensor(size_type index, Args&&... opArgs) {
 		Operator op;
-		switch (getTensorType(index)) {
-			case MType_Integer: op(this->getTensor<mint, Mode>(index), std::forward<Args>(opArgs)...); break;
-			case MType_Real: op(this->getTensor<double, Mode>(index), std::forward<Args>(opArgs)...); break;
-			case MType_Complex: op(this->getTensor<std::complex<double>, Mode>(index), std::forward<Args>(opArgs)...); break;
-			default:
-				ErrorManager::throwExceptionWithDebugInfo(ErrorName::MArgumentTensorError,
-														  "Incorrect type of Tensor argument. Argument index: " + std::to_string(index));
-		}
+		operateOnTensor<TensorTypes, Mode>(index, [&](auto&& container) {
+			op(std::forward<decltype(container)>(container), std::forward<Args>(opArgs)...);
+		});
 	}
 
 	template<Passing Mode, class Operator>
 	void MArgumentManager::operateOnTensor(size_type index, Operator&& op) {
-		switch (getTensorType(index)) {
-			case MType_Integer: op(this->getTensor<mint, Mode>(index)); break;
-			case MType_Real: op(this->getTensor<double, Mode>(index)); break;
-			case MType_Complex: op(this->getTensor<std::complex<double>, Mode>(index)); break;
-			default:
-				ErrorManager::throwExceptionWithDebugInfo(ErrorName::MArgumentTensorError,
-														  "Incorrect type of Tensor argument. Argument index: " + std::to_string(index));
-		}
+		operateOnTensor<TensorTypes, Mode>(index, std::forward<Operator>(op));
+	}
+
+	template<typename Types, Passing Mode, class Operator>
+	void MArgumentManager::operateOnTensor(size_type index, Operator&& op) {
+		Detail::dispatchType<TensorTypeCodes>(
+			TypeListIntersection<Types, TensorTypes> {}, getTensorType(index),
+			[&](auto tag) {
+				using T = typename decltype(tag)::type;
+				op(this->getTensor<T, Mode>(index));
+			},
+			ErrorName::MArgumentTensorError, [index] { return "Incorrect type of Tensor argument. Argument index: " + std::to_string(index); });
 	}
 
 	template<typename T, Passing Mode>
@@ -996,35 +1073,40 @@ namespace LLU {
 	template<Passing Mode, class Operator, class... Args>
 	void MArgumentManager::operateOnImage(size_type index, Args&&... opArgs) {
 		Operator op;
-		switch (getImageType(index)) {
-			case MImage_Type_Bit: op(this->getImage<int8_t, Mode>(index), std::forward<Args>(opArgs)...); break;
-			case MImage_Type_Bit8: op(this->getImage<uint8_t, Mode>(index), std::forward<Args>(opArgs)...); break;
-			case MImage_Type_Bit16: op(this->getImage<uint16_t, Mode>(index), std::forward<Args>(opArgs)...); break;
-			case MImage_Type_Real32: op(this->getImage<float, Mode>(index), std::forward<Args>(opArgs)...); break;
-			case MImage_Type_Real: op(this->getImage<double, Mode>(index), std::forward<Args>(opArgs)...); break;
-			default:
-				ErrorManager::throwExceptionWithDebugInfo(ErrorName::MArgumentImageError,
-														  "Incorrect type of Image argument. Argument index: " + std::to_string(index));
-		}
+		operateOnImage<ImageTypes, Mode>(index, [&](auto&& container) {
+			op(std::forward<decltype(container)>(container), std::forward<Args>(opArgs)...);
+		});
 	}
 
 	template<Passing Mode, class Operator>
 	void MArgumentManager::operateOnImage(size_type index, Operator&& op) {
-		switch (getImageType(index)) {
-			case MImage_Type_Bit: op(std::move(this->getImage<int8_t, Mode>(index))); break;
-			case MImage_Type_Bit8: op(this->getImage<uint8_t, Mode>(index)); break;
-			case MImage_Type_Bit16: op(this->getImage<uint16_t, Mode>(index)); break;
-			case MImage_Type_Real32: op(this->getImage<float, Mode>(index)); break;
-			case MImage_Type_Real: op(this->getImage<double, Mode>(index)); break;
-			default:
-				ErrorManager::throwExceptionWithDebugInfo(ErrorName::MArgumentImageError,
-														  "Incorrect type of Image argument. Argument index: " + std::to_string(index));
-		}
+		operateOnImage<ImageTypes, Mode>(index, std::forward<Operator>(op));
+	}
+
+	template<typename Types, Passing Mode, class Operator>
+	void MArgumentManager::operateOnImage(size_type index, Operator&& op) {
+		Detail::dispatchType<ImageTypeCodes>(
+			TypeListIntersection<Types, ImageTypes> {}, getImageType(index),
+			[&](auto tag) {
+				using T = typename decltype(tag)::type;
+				op(this->getImage<T, Mode>(index));
+			},
+			ErrorName::MArgumentImageError, [index] { return "Incorrect type of Image argument. Argument index: " + std::to_string(index); });
 	}
 
 	template<typename T, Passing Mode>
-	DataList<T> MArgumentManager::getDataList(size_type index) const {
-		return DataList<T>(getGenericDataList<Mode>(index));
+	SparseArray<T> MArgumentManager::getSparseArray(size_type index) const {
+		return SparseArray<T> { getGenericSparseArray<Mode>(index) };
+	}
+
+	template<typename T>
+	void MArgumentManager::setSparseArray(const SparseArray<T>& sa) {
+		sa.pass(res);
+	}
+
+	template<typename T, Passing Mode>
+	DataList<T> MArgumentManager::getDataList(size_type index, DataListValidation validation) const {
+		return DataList<T>(getGenericDataList<Mode>(index), validation);
 	}
 
 	template<typename T>
@@ -1047,6 +1129,11 @@ namespace LLU {
 		return {getMImage(index), getOwner(Mode)};
 	}
 
+	template<Passing Mode>
+	GenericSparseArray MArgumentManager::getGenericSparseArray(size_type index) const {
+		return {getMSparseArray(index), getOwner(Mode)};
+	}
+
 	template<Passing Mode>
 	GenericDataList MArgumentManager::getGenericDataList(size_type index) const {
 		static_assert(Mode != Passing::Shared, "DataStore cannot be passed as \"Shared\".");
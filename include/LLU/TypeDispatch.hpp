@@ -0,0 +1,186 @@
+/**
+ * @file	TypeDispatch.hpp
+ * @brief	Compile-time type lists and a table-driven dispatch from runtime data type codes to C++ types.
+ *
+ * Functions that operate on containers of unknown data type (like asTypedNumericArray or MArgumentManager::operateOnImage) need to map
+ * the runtime type code of a container to a C++ type and call a generic callback with it. The callback is instantiated once for every type
+ * in a TypeList, so restricting the list to types that are actually expected reduces both compile time and binary size.
+ */
+#ifndef LLU_TYPEDISPATCH_HPP
+#define LLU_TYPEDISPATCH_HPP
+
+#include <array>
+#include <complex>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "LLU/ErrorLog/ErrorManager.h"
+#include "LLU/Utilities.hpp"
+
+namespace LLU {
+
+	/// Compile-time list of types
+	template<typename... Ts>
+	struct TypeList {
+		/// Number of types in the list
+		static constexpr std::size_t size = sizeof...(Ts);
+	};
+
+	/// Empty value representing a type, passed to callbacks by dispatchType
+	template<typename T>
+	struct TypeTag {
+		/// Type represented by the tag
+		using type = T;
+	};
+
+	/// @cond
+	namespace Detail {
+		template<typename T, typename List>
+		struct ListContains;
+
+		template<typename T, typename... Ts>
+		struct ListContains<T, TypeList<Ts...>> : std::bool_constant<(std::is_same_v<T, Ts> || ...)> {};
+
+		template<typename... Lists>
+		struct ListConcat;
+
+		template<typename... Ts>
+		struct ListConcat<TypeList<Ts...>> {
+			using type = TypeList<Ts...>;
+		};
+
+		template<typename... Ts, typename... Us, typename... Rest>
+		struct ListConcat<TypeList<Ts...>, TypeList<Us...>, Rest...> {
+			using type = typename ListConcat<TypeList<Ts..., Us...>, Rest...>::type;
+		};
+
+		template<typename List, typename Allowed>
+		struct ListIntersection;
+
+		template<typename... Ts, typename Allowed>
+		struct ListIntersection<TypeList<Ts...>, Allowed> {
+			using type = typename ListConcat<TypeList<>, std::conditional_t<ListContains<Ts, Allowed>::value, TypeList<Ts>, TypeList<>>...>::type;
+		};
+	}  // namespace Detail
+	/// @endcond
+
+	/// Check at compile time if type T is an element of a TypeList
+	template<typename T, typename List>
+	inline constexpr bool TypeListContains = Detail::ListContains<T, List>::value;
+
+	/// Concatenation of TypeLists
+	template<typename... Lists>
+	using TypeListConcat = typename Detail::ListConcat<Lists...>::type;
+
+	/// TypeList of elements of \p List which are also elements of \p Allowed, in the order of \p List
+	template<typename List, typename Allowed>
+	using TypeListIntersection = typename Detail::ListIntersection<List, Allowed>::type;
+
+	/// Signed integer types
+	using SignedIntegerTypes = TypeList<std::int8_t, std::int16_t, std::int32_t, std::int64_t>;
+
+	/// Unsigned integer types
+	using UnsignedIntegerTypes = TypeList<std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t>;
+
+	/// Integer types, including mint
+	using IntegerTypes = TypeListConcat<SignedIntegerTypes, UnsignedIntegerTypes,
+										std::conditional_t<TypeListContains<mint, SignedIntegerTypes>, TypeList<>, TypeList<mint>>>;
+
+	/// Floating point types
+	using FloatingTypes = TypeList<float, double>;
+
+	/// Complex types
+	using ComplexTypes = TypeList<std::complex<float>, std::complex<double>>;
+
+	/// Integer and floating point types
+	using RealTypes = TypeListConcat<IntegerTypes, FloatingTypes>;
+
+	/// All data types supported by NumericArray
+	using NumericArrayTypes = TypeList<std::int8_t, std::uint8_t, std::int16_t, std::uint16_t, std::int32_t, std::uint32_t, std::int64_t, std::uint64_t,
+									   float, double, std::complex<float>, std::complex<double>>;
+
+	/// All data types supported by Tensor
+	using TensorTypes = TypeList<mint, double, std::complex<double>>;
+
+	/// All data types supported by Image
+	using ImageTypes = TypeList<std::int8_t, std::uint8_t, std::uint16_t, float, double>;
+
+	/// All data types supported by any of the containers
+	using AllTypes = TypeListConcat<NumericArrayTypes, std::conditional_t<TypeListContains<mint, NumericArrayTypes>, TypeList<>, TypeList<mint>>>;
+
+	/// Mapping from C++ types to MNumericArray type codes, for use with dispatchType
+	struct NumericArrayTypeCodes {
+		/// Type of runtime type codes
+		using code_type = numericarray_data_t;
+
+		/// Get the type code of T
+		template<typename T>
+		static constexpr code_type of() {
+			return NumericArrayType<T>;
+		}
+	};
+
+	/// Mapping from C++ types to MTensor type codes, for use with dispatchType
+	struct TensorTypeCodes {
+		/// Type of runtime type codes
+		using code_type = mint;
+
+		/// Get the type code of T
+		template<typename T>
+		static constexpr code_type of() {
+			return TensorType<T>;
+		}
+	};
+
+	/// Mapping from C++ types to MImage type codes, for use with dispatchType
+	struct ImageTypeCodes {
+		/// Type of runtime type codes
+		using code_type = imagedata_t;
+
+		/// Get the type code of T
+		template<typename T>
+		static constexpr code_type of() {
+			return ImageType<T>;
+		}
+	};
+
+	/// @cond
+	namespace Detail {
+		/// Call f with a TypeTag of the type from the list whose code equals code, or throw errorName with debug info obtained from makeDebugInfo()
+		template<typename Codes, typename F, typename DebugInfo, typename... Ts>
+		decltype(auto) dispatchType(TypeList<Ts...> /*types*/, typename Codes::code_type code, F&& f, const std::string& errorName,
+									DebugInfo&& makeDebugInfo) {
+			static_assert(sizeof...(Ts) > 0, "Type dispatch requires a non-empty list of types.");
+			using Result = std::common_type_t<std::invoke_result_t<F, TypeTag<Ts>>...>;
+			using Thunk = Result (*)(F&);
+			static constexpr std::array<typename Codes::code_type, sizeof...(Ts)> codes {Codes::template of<Ts>()...};
+			static constexpr std::array<Thunk, sizeof...(Ts)> thunks {+[](F& g) -> Result { return std::forward<F>(g)(TypeTag<Ts> {}); }...};
+			for (std::size_t i = 0; i < codes.size(); ++i) {
+				if (codes[i] == code) {
+					return thunks[i](f);
+				}
+			}
+			ErrorManager::throwExceptionWithDebugInfo(errorName, std::forward<DebugInfo>(makeDebugInfo)());
+		}
+	}  // namespace Detail
+	/// @endcond
+
+	/**
+	 * @brief   Call \p f with a TypeTag of the type from \p Types whose type code equals \p code
+	 * @tparam  Types - TypeList of candidate types, \p f is instantiated for each of them
+	 * @tparam  Codes - mapping from C++ types to type codes, e.g. NumericArrayTypeCodes
+	 * @param   code - runtime type code
+	 * @param   errorName - name of the error thrown when none of the types matches \p code
+	 * @param   f - callable taking a TypeTag<T>, it must return the same type (or types with a common type) for all T
+	 * @return  result of calling \p f
+	 * @throws  errorName - if none of \p Types corresponds to \p code
+	 */
+	template<typename Types, typename Codes, typename F>
+	decltype(auto) dispatchType(typename Codes::code_type code, const std::string& errorName, F&& f) {
+		return Detail::dispatchType<Codes>(Types {}, code, std::forward<F>(f), errorName, [] { return std::string {}; });
+	}
+
+}  // namespace LLU
+
+#endif	  // LLU_TYPEDISPATCH_HPP
@@ -45,7 +45,7 @@ namespace LLU::Argument {
 		/// Tensor stands for a GenericTensor - type agnostic wrapper over MTensor
 		using Tensor = MContainer<MArgumentType::Tensor>;
 
-		/// SparseArray type corresponds to the "raw" MSparseArray as LLU does not have its own wrapper for this structure yet
+		/// SparseArray type corresponds to the "raw" MSparseArray, it can be wrapped into GenericSparseArray or SparseArray<T> when needed
 		using SparseArray = MSparseArray;
 
 		/// NumericArray stands for a GenericNumericArray - type agnostic wrapper over MNumericArray
@@ -118,7 +118,7 @@ namespace LLU::Argument {
 	template<MArgumentType T>
 	WrapperType<T> toWrapperType(const CType<T>& value) {
 		if constexpr (T == MArgumentType::Complex) {
-			return {value->ri[0], value->ri[1]};
+			return {value.ri[0], value.ri[1]};
 		} else if constexpr (T == MArgumentType::UTF8String) {
 			return {value};
 		} else if constexpr (ContainerTypeQ<T> && T != MArgumentType::SparseArray) {
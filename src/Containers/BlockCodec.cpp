@@ -0,0 +1,301 @@
+/**
+ * @file	BlockCodec.cpp
+ * @brief	Implementation of the byte shuffle and the LZ coder
+ */
+
+#include "LLU/Containers/BlockCodec.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "LLU/ErrorLog/ErrorManager.h"
+
+namespace LLU {
+
+	namespace {
+		using byte_t = unsigned char;
+
+		constexpr std::size_t minMatch = 4;
+		constexpr std::size_t maxOffset = 65535;
+		// the last bytes of a block are always literals and no match starts too close to the end, the same as in LZ4
+		constexpr std::size_t lastLiterals = 5;
+		constexpr std::size_t matchStartLimit = 12;
+		constexpr unsigned hashLog = 14;
+		constexpr unsigned lengthBits = 4;
+		constexpr std::size_t lengthMask = (1U << lengthBits) - 1;
+
+		std::uint32_t read32(const byte_t* p) noexcept {
+			std::uint32_t v = 0;
+			std::memcpy(&v, p, sizeof(v));
+			return v;
+		}
+
+		std::uint32_t hash(std::uint32_t sequence) noexcept {
+			return (sequence * 2654435761U) >> (32U - hashLog);
+		}
+
+		byte_t* writeLength(byte_t* op, std::size_t length) noexcept {
+			for (; length >= 255; length -= 255) {
+				*op++ = 255;
+			}
+			*op++ = static_cast<byte_t>(length);
+			return op;
+		}
+
+		byte_t* writeSequence(byte_t* op, const byte_t* literals, std::size_t literalCount, std::size_t offset, std::size_t matchLength) noexcept {
+			byte_t* token = op++;
+			const std::size_t matchCode = matchLength > 0 ? matchLength - minMatch : 0;
+			*token = static_cast<byte_t>((std::min(literalCount, lengthMask) << lengthBits) | std::min(matchCode, lengthMask));
+			if (literalCount >= lengthMask) {
+				op = writeLength(op, literalCount - lengthMask);
+			}
+			std::memcpy(op, literals, literalCount);
+			op += literalCount;
+			if (matchLength == 0) {
+				return op;
+			}
+			*op++ = static_cast<byte_t>(offset & 0xFFU);
+			*op++ = static_cast<byte_t>(offset >> 8U);
+			if (matchCode >= lengthMask) {
+				op = writeLength(op, matchCode - lengthMask);
+			}
+			return op;
+		}
+
+		std::size_t lzCompress(const byte_t* src, std::size_t count, byte_t* dst) noexcept {
+			const byte_t* ip = src;
+			const byte_t* anchor = src;
+			const byte_t* const end = src + count;
+			byte_t* op = dst;
+			if (count > matchStartLimit) {
+				const byte_t* const matchLimit = end - lastLiterals;
+				const byte_t* const startLimit = end - matchStartLimit;
+				thread_local std::vector<std::uint32_t> table(std::size_t {1} << hashLog);
+				std::fill(table.begin(), table.end(), 0);
+				std::size_t misses = 0;
+				while (ip < startLimit) {
+					const std::uint32_t sequence = read32(ip);
+					const std::uint32_t h = hash(sequence);
+					const byte_t* candidate = src + table[h];
+					table[h] = static_cast<std::uint32_t>(ip - src);
+					if (candidate >= ip || static_cast<std::size_t>(ip - candidate) > maxOffset || read32(candidate) != sequence) {
+						// skip faster through data that does not compress
+						ip += 1 + (misses++ >> 6U);
+						continue;
+					}
+					misses = 0;
+					while (ip > anchor && candidate > src && ip[-1] == candidate[-1]) {
+						--ip;
+						--candidate;
+					}
+					std::size_t length = minMatch;
+					while (ip + length < matchLimit && ip[length] == candidate[length]) {
+						++length;
+					}
+					op = writeSequence(op, anchor, static_cast<std::size_t>(ip - anchor), static_cast<std::size_t>(ip - candidate), length);
+					ip += length;
+					anchor = ip;
+					if (ip < startLimit) {
+						table[hash(read32(ip - 2))] = static_cast<std::uint32_t>(ip - 2 - src);
+					}
+				}
+			}
+			op = writeSequence(op, anchor, static_cast<std::size_t>(end - anchor), 0, 0);
+			return static_cast<std::size_t>(op - dst);
+		}
+
+		void lzDecompress(const byte_t* ip, std::size_t srcCount, byte_t* dst, std::size_t count) {
+			const byte_t* const iend = ip + srcCount;
+			byte_t* op = dst;
+			byte_t* const oend = dst + count;
+			auto corrupted = [] { ErrorManager::throwException(ErrorName::DecompressionFailed); };
+			auto readLength = [&](std::size_t length) {
+				if (length == lengthMask) {
+					byte_t b = 0;
+					do {
+						if (ip == iend) {
+							corrupted();
+						}
+						b = *ip++;
+						length += b;
+					} while (b == 255);
+				}
+				return length;
+			};
+			while (true) {
+				if (ip == iend) {
+					corrupted();
+				}
+				const byte_t token = *ip++;
+				const std::size_t literalCount = readLength(token >> lengthBits);
+				if (literalCount > static_cast<std::size_t>(iend - ip) || literalCount > static_cast<std::size_t>(oend - op)) {
+					corrupted();
+				}
+				std::memcpy(op, ip, literalCount);
+				ip += literalCount;
+				op += literalCount;
+				if (ip == iend) {
+					break;
+				}
+				if (iend - ip < 2) {
+					corrupted();
+				}
+				const std::size_t offset = ip[0] | (static_cast<std::size_t>(ip[1]) << 8U);
+				ip += 2;
+				const std::size_t length = readLength(token & lengthMask) + minMatch;
+				if (offset == 0 || offset > static_cast<std::size_t>(op - dst) || length > static_cast<std::size_t>(oend - op)) {
+					corrupted();
+				}
+				// an overlapping match repeats the last offset bytes, so the already copied part is doubled in each step
+				const byte_t* match = op - offset;
+				for (std::size_t remaining = length; remaining > 0;) {
+					const std::size_t n = std::min(static_cast<std::size_t>(op - match), remaining);
+					std::memcpy(op, match, n);
+					op += n;
+					remaining -= n;
+				}
+			}
+			if (op != oend) {
+				corrupted();
+			}
+		}
+
+		/// Transpose an 8x8 matrix of bytes, where row i is stored in word i and its j-th byte is bits 8j to 8j+7
+		void transpose8x8(std::array<std::uint64_t, 8>& rows) noexcept {
+			auto swap = [&rows](std::size_t i, std::size_t j, unsigned shift, std::uint64_t mask) {
+				const std::uint64_t t = ((rows[i] >> shift) ^ rows[j]) & mask;
+				rows[j] ^= t;
+				rows[i] ^= t << shift;
+			};
+			// swap single bytes, then pairs of bytes and finally quadruples of bytes between neighboring rows, pairs of rows and quadruples of rows
+			constexpr std::uint64_t bytes = 0x00FF00FF00FF00FFULL;
+			swap(0, 1, 8U, bytes);
+			swap(2, 3, 8U, bytes);
+			swap(4, 5, 8U, bytes);
+			swap(6, 7, 8U, bytes);
+			constexpr std::uint64_t pairs = 0x0000FFFF0000FFFFULL;
+			swap(0, 2, 16U, pairs);
+			swap(1, 3, 16U, pairs);
+			swap(4, 6, 16U, pairs);
+			swap(5, 7, 16U, pairs);
+			constexpr std::uint64_t quads = 0x00000000FFFFFFFFULL;
+			swap(0, 4, 32U, quads);
+			swap(1, 5, 32U, quads);
+			swap(2, 6, 32U, quads);
+			swap(3, 7, 32U, quads);
+		}
+
+		// elements are transposed in tiles which fit in the L1 cache, so that both reads and writes are sequential within a tile
+		constexpr std::size_t tileElements = 1024;
+
+		template<std::size_t ElementSize>
+		void shuffle(const byte_t* src, std::size_t elements, std::size_t elementSize, byte_t* dst) noexcept {
+			const std::size_t size = ElementSize ? ElementSize : elementSize;
+			std::size_t start = 0;
+			if constexpr (ElementSize == 8) {
+				// 8 elements of 8 bytes form a square matrix of bytes, transposed with a few word operations
+				std::array<std::uint64_t, 8> rows {};
+				for (; start + 8 <= elements; start += 8) {
+					std::memcpy(rows.data(), src + start * 8, sizeof(rows));
+					transpose8x8(rows);
+					for (std::size_t b = 0; b < 8; ++b) {
+						std::memcpy(dst + b * elements + start, &rows[b], sizeof(std::uint64_t));
+					}
+				}
+			}
+			for (std::size_t first = start; first < elements; first += tileElements) {
+				const std::size_t last = std::min(first + tileElements, elements);
+				for (std::size_t b = 0; b < size; ++b) {
+					byte_t* out = dst + b * elements;
+					for (std::size_t i = first; i < last; ++i) {
+						out[i] = src[i * size + b];
+					}
+				}
+			}
+		}
+
+		template<std::size_t ElementSize>
+		void unshuffle(const byte_t* src, std::size_t elements, std::size_t elementSize, byte_t* dst) noexcept {
+			const std::size_t size = ElementSize ? ElementSize : elementSize;
+			std::size_t start = 0;
+			if constexpr (ElementSize == 8) {
+				std::array<std::uint64_t, 8> rows {};
+				for (; start + 8 <= elements; start += 8) {
+					for (std::size_t b = 0; b < 8; ++b) {
+						std::memcpy(&rows[b], src + b * elements + start, sizeof(std::uint64_t));
+					}
+					transpose8x8(rows);
+					std::memcpy(dst + start * 8, rows.data(), sizeof(rows));
+				}
+			}
+			for (std::size_t first = start; first < elements; first += tileElements) {
+				const std::size_t last = std::min(first + tileElements, elements);
+				for (std::size_t b = 0; b < size; ++b) {
+					const byte_t* in = src + b * elements;
+					for (std::size_t i = first; i < last; ++i) {
+						dst[i * size + b] = in[i];
+					}
+				}
+			}
+		}
+
+		/// Transpose the bytes of elements (or the inverse), with the common element sizes known at compile time so that the inner loop is unrolled
+		template<bool Inverse>
+		void transposeBytes(const byte_t* src, std::size_t count, std::size_t elementSize, byte_t* dst) noexcept {
+			const std::size_t elements = count / elementSize;
+			auto run = [&](auto size) {
+				if constexpr (Inverse) {
+					unshuffle<decltype(size)::value>(src, elements, elementSize, dst);
+				} else {
+					shuffle<decltype(size)::value>(src, elements, elementSize, dst);
+				}
+			};
+			switch (elementSize) {
+				case 2: run(std::integral_constant<std::size_t, 2> {}); break;
+				case 4: run(std::integral_constant<std::size_t, 4> {}); break;
+				case 8: run(std::integral_constant<std::size_t, 8> {}); break;
+				case 16: run(std::integral_constant<std::size_t, 16> {}); break;
+				default: run(std::integral_constant<std::size_t, 0> {}); break;
+			}
+			std::memcpy(dst + elements * elementSize, src + elements * elementSize, count - elements * elementSize);
+		}
+
+		/// Get a per-thread buffer of at least \p count bytes, reused between calls to avoid page faults on freshly allocated memory
+		byte_t* scratch(std::size_t count) {
+			thread_local std::vector<byte_t> buffer;
+			if (buffer.size() < count) {
+				buffer.resize(count);
+			}
+			return buffer.data();
+		}
+	}  // namespace
+
+	std::size_t compressBound(std::size_t count) noexcept {
+		return count + count / 255 + 16;
+	}
+
+	std::size_t compressBlock(const void* src, std::size_t count, void* dst, std::size_t elementSize) {
+		const auto* bytes = static_cast<const byte_t*>(src);
+		if (elementSize <= 1) {
+			return lzCompress(bytes, count, static_cast<byte_t*>(dst));
+		}
+		byte_t* shuffled = scratch(count);
+		transposeBytes<false>(bytes, count, elementSize, shuffled);
+		return lzCompress(shuffled, count, static_cast<byte_t*>(dst));
+	}
+
+	void decompressBlock(const void* src, std::size_t srcCount, void* dst, std::size_t count, std::size_t elementSize) {
+		const auto* bytes = static_cast<const byte_t*>(src);
+		if (elementSize <= 1) {
+			lzDecompress(bytes, srcCount, static_cast<byte_t*>(dst), count);
+			return;
+		}
+		byte_t* shuffled = scratch(count);
+		lzDecompress(bytes, srcCount, shuffled, count);
+		transposeBytes<true>(shuffled, count, elementSize, static_cast<byte_t*>(dst));
+	}
+
+}  // namespace LLU
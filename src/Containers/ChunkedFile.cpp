@@ -0,0 +1,307 @@
+/**
+ * @file	ChunkedFile.cpp
+ * @brief	Implementation of chunked file reader and writer
+ */
+
+#include "LLU/Containers/ChunkedFile.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <ios>
+#include <limits>
+#include <utility>
+
+#include "LLU/TypeDispatch.hpp"
+
+namespace LLU {
+
+	namespace {
+		constexpr std::array<char, 4> chunkedFileMagic {'L', 'L', 'U', 'C'};
+		/// Version 1 has only the checksums flag, version 2 adds the compression method, so that older readers reject compressed files
+		constexpr std::uint8_t chunkedFileVersion = 2;
+		constexpr std::uint8_t uncompressedFileVersion = 1;
+		constexpr std::uint8_t checksumsFlag = 1;
+		constexpr std::uint8_t compressionShift = 1;
+		constexpr std::size_t fixedHeaderSize = 24;
+		constexpr std::size_t dataAlignment = 64;
+
+		constexpr std::uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+		constexpr std::uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+		constexpr std::uint64_t prime3 = 0x165667B19E3779F9ULL;
+
+		constexpr std::uint64_t rotl(std::uint64_t x, unsigned r) noexcept {
+			return (x << r) | (x >> (64U - r));
+		}
+
+		constexpr std::uint64_t mixRound(std::uint64_t acc, std::uint64_t word) noexcept {
+			return rotl(acc + word * prime2, 31U) * prime1;
+		}
+
+		std::uint64_t load64(const unsigned char* p) noexcept {
+			std::uint64_t w = 0;
+			std::memcpy(&w, p, sizeof(w));
+			return w;
+		}
+
+		std::size_t elementSize(numericarray_data_t type) {
+			return dispatchType<NumericArrayTypes, NumericArrayTypeCodes>(type, ErrorName::NumericArrayTypeError,
+																		  [](auto tag) { return sizeof(typename decltype(tag)::type); });
+		}
+	}  // namespace
+
+	std::uint64_t checksum64(const void* data, std::size_t count) noexcept {
+		const auto* p = static_cast<const unsigned char*>(data);
+		const auto* const end = p + count;
+		// four independent lanes keep the multipliers busy, so the checksum is computed much faster than data is read from disk
+		std::array<std::uint64_t, 4> lanes {prime1 + prime2, prime2, 0, std::uint64_t {0} - prime1};
+		for (; end - p >= 32; p += 32) {
+			for (std::size_t i = 0; i < lanes.size(); ++i) {
+				lanes[i] = mixRound(lanes[i], load64(p + 8 * i));
+			}
+		}
+		std::uint64_t h = rotl(lanes[0], 1U) + rotl(lanes[1], 7U) + rotl(lanes[2], 12U) + rotl(lanes[3], 18U);
+		h += static_cast<std::uint64_t>(count);
+		for (; end - p >= 8; p += 8) {
+			h = rotl(h ^ mixRound(0, load64(p)), 27U) * prime1 + prime3;
+		}
+		for (; p < end; ++p) {
+			h = rotl(h ^ (*p * prime3), 11U) * prime1;
+		}
+		h ^= h >> 33U;
+		h *= prime2;
+		h ^= h >> 29U;
+		h *= prime3;
+		h ^= h >> 32U;
+		return h;
+	}
+
+	std::size_t ChunkedFileHeader::elementSize() const {
+		return LLU::elementSize(type);
+	}
+
+	std::size_t ChunkedFileHeader::dataSize() const {
+		return static_cast<std::size_t>(dims.flatCount()) * elementSize();
+	}
+
+	mint ChunkedFileHeader::blockCount() const {
+		return static_cast<mint>((dataSize() + blockSize - 1) / blockSize);
+	}
+
+	std::size_t ChunkedFileHeader::blockBytes(mint index) const {
+		const std::size_t first = static_cast<std::size_t>(index) * blockSize;
+		const std::size_t total = dataSize();
+		return first < total ? std::min(blockSize, total - first) : 0;
+	}
+
+	std::uint64_t ChunkedFileHeader::checksumOffset() const noexcept {
+		return fixedHeaderSize + static_cast<std::uint64_t>(dims.rank()) * sizeof(std::int64_t);
+	}
+
+	std::uint64_t ChunkedFileHeader::blockTableOffset() const {
+		return checksumOffset() + (checksums ? static_cast<std::uint64_t>(blockCount()) * sizeof(std::uint64_t) : 0);
+	}
+
+	std::uint64_t ChunkedFileHeader::dataOffset() const {
+		const std::uint64_t tableEnd =
+			blockTableOffset() + (compression != Compression::None ? static_cast<std::uint64_t>(blockCount()) * sizeof(Block) : 0);
+		return (tableEnd + dataAlignment - 1) / dataAlignment * dataAlignment;
+	}
+
+	ChunkedFileReader::ChunkedFileReader(const std::string& fileName)
+		: file {openFile(fileName, std::ios::in | std::ios::binary)}, name {fileName}, hdr {} {
+		auto invalid = [&fileName] { ErrorManager::throwException(ErrorName::InvalidArrayFileHeader, fileName); };
+		std::array<unsigned char, fixedHeaderSize> fixed {};
+		if (readAt(file.get(), fixed.data(), fixed.size(), 0) != fixed.size() ||
+			std::memcmp(fixed.data(), chunkedFileMagic.data(), chunkedFileMagic.size()) != 0 || fixed[4] < uncompressedFileVersion ||
+			fixed[4] > chunkedFileVersion) {
+			invalid();
+		}
+		std::uint16_t typeCode = 0;
+		std::int64_t rank = 0;
+		std::uint64_t blockSize = 0;
+		std::memcpy(&typeCode, fixed.data() + 6, sizeof(typeCode));
+		std::memcpy(&rank, fixed.data() + 8, sizeof(rank));
+		std::memcpy(&blockSize, fixed.data() + 16, sizeof(blockSize));
+		const std::uint64_t size = fileSize(file.get());
+		if (rank <= 0 || static_cast<std::uint64_t>(rank) > (size - fixedHeaderSize) / sizeof(std::int64_t) || blockSize == 0) {
+			invalid();
+		}
+		std::vector<std::int64_t> dims(static_cast<std::size_t>(rank));
+		const std::size_t dimsBytes = dims.size() * sizeof(std::int64_t);
+		if (readAt(file.get(), dims.data(), dimsBytes, fixedHeaderSize) != dimsBytes) {
+			invalid();
+		}
+		hdr.type = static_cast<numericarray_data_t>(typeCode);
+		const std::size_t elemSize = hdr.elementSize();
+		// the number of elements must fit in mint and the number of bytes in size_t, only the last dimension may be 0 (as in MArrayDimensions)
+		const std::uint64_t maxCount =
+			std::min<std::uint64_t>(static_cast<std::uint64_t>((std::numeric_limits<mint>::max)()), (std::numeric_limits<std::size_t>::max)() / elemSize);
+		std::uint64_t count = 1;
+		for (std::size_t i = 0; i < dims.size(); ++i) {
+			const auto d = dims[i];
+			if (d < 0 || (d == 0 && i + 1 < dims.size()) || (d > 0 && count > maxCount / static_cast<std::uint64_t>(d))) {
+				invalid();
+			}
+			count *= static_cast<std::uint64_t>(d);
+		}
+		hdr.dims = MArrayDimensions {dims};
+		hdr.blockSize = static_cast<std::size_t>(blockSize);
+		hdr.checksums = (fixed[5] & checksumsFlag) != 0;
+		const auto compression = static_cast<unsigned>(fixed[5]) >> compressionShift;
+		if (hdr.blockSize % elemSize != 0 || compression > static_cast<unsigned>(Compression::ShuffleLZ) ||
+			(fixed[4] == uncompressedFileVersion && compression != 0)) {
+			invalid();
+		}
+		hdr.compression = static_cast<Compression>(compression);
+		// tables have one entry per block, so a tiny block size in a corrupted header could otherwise request huge tables
+		const std::uint64_t entryBytes =
+			(hdr.checksums ? sizeof(std::uint64_t) : 0) + (hdr.compression != Compression::None ? sizeof(ChunkedFileHeader::Block) : 0);
+		if (entryBytes > 0 && static_cast<std::uint64_t>(hdr.blockCount()) > (size - hdr.checksumOffset()) / entryBytes) {
+			invalid();
+		}
+		if (hdr.checksums) {
+			sums.resize(static_cast<std::size_t>(hdr.blockCount()));
+			const std::size_t tableBytes = sums.size() * sizeof(std::uint64_t);
+			if (readAt(file.get(), sums.data(), tableBytes, hdr.checksumOffset()) != tableBytes) {
+				invalid();
+			}
+		}
+		if (hdr.compression != Compression::None) {
+			blocks.resize(static_cast<std::size_t>(hdr.blockCount()));
+			const std::size_t tableBytes = blocks.size() * sizeof(ChunkedFileHeader::Block);
+			if (readAt(file.get(), blocks.data(), tableBytes, hdr.blockTableOffset()) != tableBytes) {
+				invalid();
+			}
+			for (std::size_t b = 0; b < blocks.size(); ++b) {
+				if (blocks[b].offset < hdr.dataOffset() || blocks[b].size > compressBound(hdr.blockBytes(static_cast<mint>(b)))) {
+					invalid();
+				}
+			}
+		}
+	}
+
+	std::uint64_t ChunkedFileReader::storedSize() const noexcept {
+		if (hdr.compression == Compression::None) {
+			return hdr.dataSize();
+		}
+		std::uint64_t total = 0;
+		for (const auto& block : blocks) {
+			total += block.size;
+		}
+		return total;
+	}
+
+	void ChunkedFileReader::readBlock(mint index, void* buffer) const {
+		if (index < 0 || index >= hdr.blockCount()) {
+			ErrorManager::throwException(ErrorName::MArrayElementIndexError, index);
+		}
+		const std::size_t bytes = hdr.blockBytes(index);
+		auto truncated = [this] { ErrorManager::throwExceptionWithDebugInfo(ErrorName::ReadFileFailed, "File " + name + " is shorter than its header declares"); };
+		if (hdr.compression == Compression::None) {
+			if (readAt(file.get(), buffer, bytes, hdr.dataOffset() + static_cast<std::uint64_t>(index) * hdr.blockSize) != bytes) {
+				truncated();
+			}
+		} else {
+			const auto& block = blocks[static_cast<std::size_t>(index)];
+			const auto stored = static_cast<std::size_t>(block.size);
+			if (stored == bytes) {
+				// the block did not get smaller when compressed, so it is stored as is
+				if (readAt(file.get(), buffer, bytes, block.offset) != bytes) {
+					truncated();
+				}
+			} else {
+				std::vector<unsigned char> compressed(stored);
+				if (readAt(file.get(), compressed.data(), stored, block.offset) != stored) {
+					truncated();
+				}
+				decompressBlock(compressed.data(), stored, buffer, bytes, hdr.elementSize());
+			}
+		}
+		if (hdr.checksums && checksum64(buffer, bytes) != sums[static_cast<std::size_t>(index)]) {
+			ErrorManager::throwException(ErrorName::ChecksumMismatch, index, name);
+		}
+	}
+
+	ChunkedFileWriter::ChunkedFileWriter(const std::string& fileName, numericarray_data_t type, MArrayDimensions dims, ChunkedFileOptions opts)
+		: file {openFile(fileName, std::ios::out | std::ios::trunc | std::ios::binary)}, name {fileName},
+		  hdr {type, std::move(dims), opts.blockSize, opts.checksums, opts.compression}, end {0} {
+		const std::size_t elemSize = hdr.elementSize();
+		hdr.blockSize = std::max(hdr.blockSize / elemSize, std::size_t {1}) * elemSize;
+		if (hdr.checksums) {
+			sums.resize(static_cast<std::size_t>(hdr.blockCount()));
+		}
+		if (hdr.compression != Compression::None) {
+			blocks.resize(static_cast<std::size_t>(hdr.blockCount()));
+		}
+		end = hdr.dataOffset();
+		std::vector<unsigned char> header(fixedHeaderSize + static_cast<std::size_t>(hdr.dims.rank()) * sizeof(std::int64_t));
+		std::memcpy(header.data(), chunkedFileMagic.data(), chunkedFileMagic.size());
+		header[4] = hdr.compression != Compression::None ? chunkedFileVersion : uncompressedFileVersion;
+		header[5] = static_cast<unsigned char>((hdr.checksums ? checksumsFlag : 0U) | (static_cast<unsigned>(hdr.compression) << compressionShift));
+		const auto typeCode = static_cast<std::uint16_t>(hdr.type);
+		const auto rank = static_cast<std::int64_t>(hdr.dims.rank());
+		const auto blockSize = static_cast<std::uint64_t>(hdr.blockSize);
+		std::memcpy(header.data() + 6, &typeCode, sizeof(typeCode));
+		std::memcpy(header.data() + 8, &rank, sizeof(rank));
+		std::memcpy(header.data() + 16, &blockSize, sizeof(blockSize));
+		for (mint i = 0; i < hdr.dims.rank(); ++i) {
+			const auto d = static_cast<std::int64_t>(hdr.dims.get(i));
+			std::memcpy(header.data() + fixedHeaderSize + static_cast<std::size_t>(i) * sizeof(d), &d, sizeof(d));
+		}
+		writeAt(file.get(), header.data(), header.size(), 0);
+	}
+
+	void ChunkedFileWriter::writeBlock(mint index, const void* buffer) {
+		if (index < 0 || index >= hdr.blockCount()) {
+			ErrorManager::throwException(ErrorName::MArrayElementIndexError, index);
+		}
+		const std::size_t bytes = hdr.blockBytes(index);
+		if (hdr.checksums) {
+			sums[static_cast<std::size_t>(index)] = checksum64(buffer, bytes);
+		}
+		if (hdr.compression == Compression::None) {
+			writeAt(file.get(), buffer, bytes, hdr.dataOffset() + static_cast<std::uint64_t>(index) * hdr.blockSize);
+			return;
+		}
+		std::vector<unsigned char> compressed(compressBound(bytes));
+		const std::size_t compressedBytes = compressBlock(buffer, bytes, compressed.data(), hdr.elementSize());
+		const bool storeQ = compressedBytes >= bytes;
+		const std::size_t stored = storeQ ? bytes : compressedBytes;
+		// blocks are placed one after another in the order in which they are finished
+		const std::uint64_t offset = end.fetch_add(stored);
+		writeAt(file.get(), storeQ ? buffer : compressed.data(), stored, offset);
+		blocks[static_cast<std::size_t>(index)] = {offset, stored};
+	}
+
+	void ChunkedFileWriter::finish() {
+		if (hdr.checksums) {
+			writeAt(file.get(), sums.data(), sums.size() * sizeof(std::uint64_t), hdr.checksumOffset());
+		}
+		if (hdr.compression != Compression::None) {
+			writeAt(file.get(), blocks.data(), blocks.size() * sizeof(ChunkedFileHeader::Block), hdr.blockTableOffset());
+		}
+		if (std::fflush(file.get()) != 0) {
+			ErrorManager::throwException(ErrorName::WriteFileFailed);
+		}
+	}
+
+	numericarray_data_t ChunkedFileWriter::tensorElementType(mint tensorType) {
+		switch (tensorType) {
+			case MType_Integer: return NumericArrayType<mint>;
+			case MType_Real: return NumericArrayType<double>;
+			case MType_Complex: return NumericArrayType<std::complex<double>>;
+			default: ErrorManager::throwException(ErrorName::TensorTypeError);
+		}
+	}
+
+	void ChunkedFileWriter::checkSource(numericarray_data_t type, const mint* dims, mint rank) const {
+		if (type != hdr.type) {
+			ErrorManager::throwException(ErrorName::NumericArrayTypeError);
+		}
+		if (MArrayDimensions {dims, rank}.get() != hdr.dims.get()) {
+			ErrorManager::throwExceptionWithDebugInfo(ErrorName::DimensionsError, "Dimensions of the array do not match file " + name);
+		}
+	}
+
+}  // namespace LLU
@@ -7,6 +7,15 @@
 
 #include "LLU/Containers/Generic/DataStore.hpp"
 
+#include <algorithm>
+#include <numeric>
+
+#include "LLU/Containers/DataListProfile.hpp"
+#include "LLU/Containers/Generic/SparseArray.hpp"
+#include "LLU/LibraryLinkFunctionMacro.h"
+#include "LLU/MArgumentManager.h"
+#include "LLU/TypeDispatch.hpp"
+
 namespace LLU {
 
 	GenericDataNode GenericDataNode::next() const noexcept {
@@ -24,17 +33,71 @@ namespace LLU {
 	}
 
 	Argument::TypedArgument GenericDataNode::value() const {
+		return Argument::fromMArgument(rawValue(), type());
+	}
+
+	MArgument GenericDataNode::rawValue() const {
 		MArgument m;
 		if (LibraryData::DataStoreAPI()->DataStoreNode_getData(node, &m) != 0) {
 			ErrorManager::throwException(ErrorName::DLGetNodeDataError);
 		}
-		return Argument::fromMArgument(m, type());
+		return m;
+	}
+
+	Argument::TypedArgument GenericDataNode::valueCopy() const {
+		return std::visit(
+			[](auto&& v) -> Argument::TypedArgument {
+				using V = remove_cv_ref<decltype(v)>;
+				if constexpr (std::is_same_v<V, MSparseArray>) {
+					return GenericSparseArray {v, Ownership::LibraryLink}.clone().abandonContainer();
+				} else if constexpr (Argument::ContainerTypeQ<Argument::WrapperIndex<V>>) {
+					return v.clone();
+				} else {
+					return std::move(v);
+				}
+			},
+			value());
 	}
 
 	GenericDataNode::operator bool() const {
 		return node != nullptr;
 	}
 
+	DataStoreIndex::DataStoreIndex(DataStore ds) {
+		auto* api = LibraryData::DataStoreAPI();
+		nodes.reserve(static_cast<std::size_t>(api->DataStore_getLength(ds)));
+		for (DataStoreNode node = api->DataStore_getFirstNode(ds); node != nullptr; node = api->DataStoreNode_getNextNode(node)) {
+			nodes.push_back(node);
+		}
+	}
+
+	void DataStoreIndex::append(DataStoreNode node) {
+		nodes.push_back(node);
+		if (namesIndexed) {
+			names.emplace(GenericDataNode {node}.name(), node);
+		}
+	}
+
+	DataStoreNode DataStoreIndex::at(mint position) const {
+		if (position < 0 || position >= size()) {
+			ErrorManager::throwException(ErrorName::DLIndexError);
+		}
+		return (*this)[position];
+	}
+
+	DataStoreNode DataStoreIndex::find(std::string_view name) {
+		if (!namesIndexed) {
+			names.reserve(nodes.size());
+			for (auto* node : nodes) {
+				// emplace does not overwrite existing entries, so each name maps to its first node
+				names.emplace(GenericDataNode {node}.name(), node);
+			}
+			namesIndexed = true;
+		}
+		auto it = names.find(name);
+		return it != names.end() ? it->second : nullptr;
+	}
+
 	MContainer<MArgumentType::DataStore>::MContainer(Container c, Ownership owner) : MContainerBase {c, owner} {
 		if (owner == Ownership::Shared) {
 			ErrorManager::throwException(ErrorName::DLSharedDataStore);
@@ -78,6 +141,28 @@ namespace LLU {
 		}
 	}
 
+	void MContainer<MArgumentType::DataStore>::append(MContainer&& other) {
+		if (&other == this) {
+			return;
+		}
+		if (length() == 0 && getOwner() == Ownership::Library && other.getOwner() == Ownership::Library) {
+			// swap the raw DataStores, so that other ends up with the empty one
+			MContainer tmp {std::move(other)};
+			other = std::move(*this);
+			*this = std::move(tmp);
+			return;
+		}
+		for (auto node : other) {
+			// push_back takes ownership of containers in the copied value
+			if (auto name = node.name(); name.empty()) {
+				push_back(node.valueCopy());
+			} else {
+				push_back(name, node.valueCopy());
+			}
+		}
+		other.reset(LibraryData::DataStoreAPI()->createDataStore());
+	}
+
 	void MContainer<MArgumentType::DataStore>::push_back(const Argument::Typed::Any& node) {
 		switch (static_cast<MArgumentType>(node.index())) {
 			case MArgumentType::MArgument: ErrorManager::throwException(ErrorName::DLInvalidNodeType);
@@ -113,4 +198,101 @@ namespace LLU {
 				break;
 		}
 	}
+
+	namespace {
+		/// Names of MArgumentTypes, used as node names in DataListProfile::toDataList
+		constexpr std::array<const char*, DataListProfile::TypeCount> TypeNames {"MArgument", "Boolean",	  "Integer", "Real",	   "Complex",	"Tensor",
+																				 "SparseArray", "NumericArray", "Image",   "UTF8String", "DataStore"};
+
+		mint tensorBytes(const GenericTensor& t) {
+			const auto elemSize =
+				dispatchType<TensorTypes, TensorTypeCodes>(t.type(), ErrorName::TensorTypeError, [](auto tag) { return sizeof(typename decltype(tag)::type); });
+			return t.getFlattenedLength() * static_cast<mint>(elemSize);
+		}
+
+		mint nodeBytes(const GenericDataNode& node) {
+			switch (node.type()) {
+				case MArgumentType::Tensor: return tensorBytes(node.asUnchecked<GenericTensor>());
+				case MArgumentType::SparseArray: {
+					GenericSparseArray sa {node.asUnchecked<MSparseArray>(), Ownership::LibraryLink};
+					return tensorBytes(GenericTensor {sa.explicitValuesTensor(), Ownership::LibraryLink}) +
+						   tensorBytes(GenericTensor {sa.columnIndicesTensor(), Ownership::LibraryLink}) +
+						   tensorBytes(GenericTensor {sa.rowPointersTensor(), Ownership::LibraryLink});
+				}
+				case MArgumentType::NumericArray: {
+					auto na = node.asUnchecked<GenericNumericArray>();
+					const auto elemSize = dispatchType<NumericArrayTypes, NumericArrayTypeCodes>(
+						na.type(), ErrorName::NumericArrayTypeError, [](auto tag) { return sizeof(typename decltype(tag)::type); });
+					return na.getFlattenedLength() * static_cast<mint>(elemSize);
+				}
+				case MArgumentType::Image: {
+					auto img = node.asUnchecked<GenericImage>();
+					const auto elemSize =
+						dispatchType<ImageTypes, ImageTypeCodes>(img.type(), ErrorName::ImageTypeError, [](auto tag) { return sizeof(typename decltype(tag)::type); });
+					return img.getFlattenedLength() * static_cast<mint>(elemSize);
+				}
+				case MArgumentType::UTF8String: return static_cast<mint>(node.asUnchecked<std::string_view>().size());
+				default: return 0;
+			}
+		}
+
+		void profileNodes(DataStore ds, mint depth, DataListProfile& profile) {
+			profile.maxDepth = std::max(profile.maxDepth, depth);
+			for (GenericDataNode node {LibraryData::DataStoreAPI()->DataStore_getFirstNode(ds)}; node; node = node.next()) {
+				const auto t = static_cast<std::size_t>(node.type());
+				++profile.nodeCounts[t];
+				profile.payloadBytes[t] += nodeBytes(node);
+				profile.nameBytes += static_cast<mint>(node.name().size());
+				if (node.type() == MArgumentType::DataStore) {
+					profileNodes(node.asUnchecked<GenericDataList>().getContainer(), depth + 1, profile);
+				}
+			}
+		}
+	}  // namespace
+
+	mint DataListProfile::totalNodes() const noexcept {
+		return std::accumulate(nodeCounts.begin(), nodeCounts.end(), mint {0});
+	}
+
+	mint DataListProfile::totalBytes() const noexcept {
+		return std::accumulate(payloadBytes.begin(), payloadBytes.end(), mint {0});
+	}
+
+	DataList<NodeType::Any> DataListProfile::toDataList() const {
+		DataList<mint> counts;
+		DataList<mint> bytes;
+		for (std::size_t t = 1; t < TypeCount; ++t) {
+			counts.push_back(TypeNames[t], nodeCounts[t]);
+			bytes.push_back(TypeNames[t], payloadBytes[t]);
+		}
+		DataList<NodeType::Any> res;
+		res.splice("NodeCounts", std::move(counts));
+		res.splice("PayloadBytes", std::move(bytes));
+		res.push_back("NameBytes", nameBytes);
+		res.push_back("TotalNodes", totalNodes());
+		res.push_back("TotalBytes", totalBytes());
+		res.push_back("MaxDepth", maxDepth);
+		return res;
+	}
+
+	DataListProfile profileDataList(const GenericDataList& list) {
+		DataListProfile profile;
+		profileNodes(list.getContainer(), 1, profile);
+		return profile;
+	}
+
+	/**
+	 * LibraryLink function that profiles a DataStore passed from the Wolfram Language, it is loaded by LLU`DataListProfile.
+	 * It is defined in this file, so that it is exported from every paclet library that uses DataLists.
+	 */
+	LIBRARY_LINK_FUNCTION(getDataListProfile) {
+		auto err = ErrorCode::NoError;
+		try {
+			MArgumentManager mngr {libData, Argc, Args, Res};
+			mngr.set(profileDataList(mngr.getGenericDataList<Passing::Constant>(0)).toDataList());
+		} catch (LibraryLinkError& e) { err = e.which(); } catch (...) {
+			err = ErrorCode::FunctionError;
+		}
+		return err;
+	}
 }	 // namespace LLU
\ No newline at end of file
@@ -0,0 +1,244 @@
+/**
+ * @file	MappedFile.cpp
+ * @brief	Implementation of MappedFile and ArrayFileHeader
+ */
+
+#include "LLU/NoMinMaxWindows.h"
+#include "LLU/Containers/MappedFile.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <ios>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "LLU/ErrorLog/ErrorManager.h"
+#include "LLU/FileUtilities.h"
+#include "LLU/TypeDispatch.hpp"
+#include "LLU/Utilities.hpp"
+
+namespace LLU {
+
+	namespace {
+		constexpr std::array<char, 4> arrayFileMagic {'L', 'L', 'U', 'A'};
+		constexpr std::uint8_t arrayFileVersion = 1;
+		constexpr std::size_t fixedHeaderSize = 16;
+
+		std::size_t elementSize(numericarray_data_t type) {
+			return dispatchType<NumericArrayTypes, NumericArrayTypeCodes>(type, ErrorName::NumericArrayTypeError,
+																		  [](auto tag) { return sizeof(typename decltype(tag)::type); });
+		}
+	}  // namespace
+
+	MappedFile::MappedFile(const std::string& fileName, MMapMode mode) : MappedFile(fileName, mode, false, 0) {}
+
+	MappedFile MappedFile::create(const std::string& fileName, std::size_t size) {
+		return {fileName, MMapMode::ReadWrite, true, size};
+	}
+
+	MappedFile::MappedFile(const std::string& fileName, MMapMode mode, bool createQ, std::size_t size) : accessMode {mode}, name {fileName} {
+		const bool writeQ = mode == MMapMode::ReadWrite;
+		validatePath(fileName, writeQ ? std::ios::in | std::ios::out : std::ios::in);
+#ifdef _WIN32
+		std::wstring fileNameUTF16 = fromUTF8toUTF16<wchar_t>(fileName);
+		HANDLE file = CreateFileW(fileNameUTF16.c_str(), writeQ ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ, FILE_SHARE_READ, nullptr,
+								  createQ ? CREATE_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE) {
+			ErrorManager::throwException(ErrorName::OpenFileFailed, fileName);
+		}
+		LARGE_INTEGER fileSize {};
+		if (createQ) {
+			fileSize.QuadPart = static_cast<LONGLONG>(size);
+			if (!SetFilePointerEx(file, fileSize, nullptr, FILE_BEGIN) || !SetEndOfFile(file)) {
+				CloseHandle(file);
+				ErrorManager::throwException(ErrorName::MapFileFailed, fileName);
+			}
+		} else if (!GetFileSizeEx(file, &fileSize)) {
+			CloseHandle(file);
+			ErrorManager::throwException(ErrorName::MapFileFailed, fileName);
+		}
+		length = static_cast<std::size_t>(fileSize.QuadPart);
+		if (length > 0) {
+			HANDLE mapping = CreateFileMappingW(file, nullptr, writeQ ? PAGE_READWRITE : PAGE_WRITECOPY, 0, 0, nullptr);
+			if (mapping != nullptr) {
+				memory = static_cast<std::byte*>(MapViewOfFile(mapping, writeQ ? FILE_MAP_WRITE : FILE_MAP_COPY, 0, 0, 0));
+				CloseHandle(mapping);
+			}
+		}
+		CloseHandle(file);
+#else
+		int flags = writeQ ? O_RDWR : O_RDONLY;
+		if (createQ) {
+			flags |= O_CREAT | O_TRUNC;
+		}
+		// NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg): open is a POSIX API function
+		const int fd = open(fileName.c_str(), flags, 0644);
+		if (fd < 0) {
+			ErrorManager::throwException(ErrorName::OpenFileFailed, fileName);
+		}
+		struct stat info {};
+		if ((createQ && ftruncate(fd, static_cast<off_t>(size)) != 0) || fstat(fd, &info) != 0) {
+			close(fd);
+			ErrorManager::throwException(ErrorName::MapFileFailed, fileName);
+		}
+		length = static_cast<std::size_t>(info.st_size);
+		if (length > 0) {
+			// Read-only mappings are private, so that writes to them (if any) never reach the file.
+			int mapFlags = writeQ ? MAP_SHARED : MAP_PRIVATE;
+#ifdef MAP_NORESERVE
+			if (!writeQ) {
+				mapFlags |= MAP_NORESERVE;
+			}
+#endif
+			void* p = mmap(nullptr, length, PROT_READ | PROT_WRITE, mapFlags, fd, 0);
+			memory = (p == MAP_FAILED) ? nullptr : static_cast<std::byte*>(p);
+		}
+		close(fd);
+#endif
+		if (length > 0 && memory == nullptr) {
+			ErrorManager::throwException(ErrorName::MapFileFailed, fileName);
+		}
+	}
+
+	MappedFile::MappedFile(MappedFile&& other) noexcept
+		: memory {std::exchange(other.memory, nullptr)}, length {std::exchange(other.length, 0)}, accessMode {other.accessMode},
+		  name {std::move(other.name)} {}
+
+	MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+		if (this != &other) {
+			unmap();
+			memory = std::exchange(other.memory, nullptr);
+			length = std::exchange(other.length, 0);
+			accessMode = other.accessMode;
+			name = std::move(other.name);
+		}
+		return *this;
+	}
+
+	MappedFile::~MappedFile() {
+		unmap();
+	}
+
+	void MappedFile::unmap() noexcept {
+		if (memory == nullptr) {
+			return;
+		}
+#ifdef _WIN32
+		UnmapViewOfFile(memory);
+#else
+		munmap(memory, length);
+#endif
+		memory = nullptr;
+		length = 0;
+	}
+
+	void MappedFile::advise(AccessHint hint, std::size_t offset, std::size_t count) const noexcept {
+#ifdef _WIN32
+		Unused(hint, offset, count);
+#else
+		if (memory == nullptr || offset >= length) {
+			return;
+		}
+		const auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+		const std::size_t first = offset / pageSize * pageSize;
+		const std::size_t last = std::min(offset + std::min(count, length - offset), length);
+		int advice = POSIX_MADV_NORMAL;
+		switch (hint) {
+			case AccessHint::Normal: advice = POSIX_MADV_NORMAL; break;
+			case AccessHint::Sequential: advice = POSIX_MADV_SEQUENTIAL; break;
+			case AccessHint::Random: advice = POSIX_MADV_RANDOM; break;
+			case AccessHint::WillNeed: advice = POSIX_MADV_WILLNEED; break;
+			case AccessHint::DontNeed: advice = POSIX_MADV_DONTNEED; break;
+		}
+		// hints are advisory, so a failure is not an error
+		static_cast<void>(posix_madvise(memory + first, last - first, advice));
+#endif
+	}
+
+	void MappedFile::flush() const {
+		if (memory == nullptr || accessMode != MMapMode::ReadWrite) {
+			return;
+		}
+#ifdef _WIN32
+		const bool flushedQ = FlushViewOfFile(memory, 0) != 0;
+#else
+		const bool flushedQ = msync(memory, length, MS_SYNC) == 0;
+#endif
+		if (!flushedQ) {
+			ErrorManager::throwException(ErrorName::MapFileFailed, name);
+		}
+	}
+
+	ArrayFileHeader ArrayFileHeader::read(const MappedFile& file) {
+		const std::byte* p = file.data();
+		const std::size_t size = file.size();
+		auto invalid = [&file] { ErrorManager::throwException(ErrorName::InvalidArrayFileHeader, file.fileName()); };
+		if (size < fixedHeaderSize || std::memcmp(p, arrayFileMagic.data(), arrayFileMagic.size()) != 0 ||
+			std::to_integer<std::uint8_t>(p[4]) != arrayFileVersion) {
+			invalid();
+		}
+		std::uint16_t typeCode = 0;
+		std::int64_t rank = 0;
+		std::memcpy(&typeCode, p + 6, sizeof(typeCode));
+		std::memcpy(&rank, p + 8, sizeof(rank));
+		if (rank < 0 || static_cast<std::uint64_t>(rank) > (size - fixedHeaderSize) / sizeof(std::int64_t)) {
+			invalid();
+		}
+		const std::size_t elemSize = elementSize(static_cast<numericarray_data_t>(typeCode));
+		// the number of elements must fit in mint and the number of bytes in size_t, otherwise a corrupted header could pass the size check below
+		const std::uint64_t maxCount =
+			std::min<std::uint64_t>(static_cast<std::uint64_t>((std::numeric_limits<mint>::max)()), (std::numeric_limits<std::size_t>::max)() / elemSize);
+		std::uint64_t count = 1;
+		std::vector<mint> dims(static_cast<std::size_t>(rank));
+		for (std::size_t i = 0; i < dims.size(); ++i) {
+			std::int64_t d = 0;
+			std::memcpy(&d, p + fixedHeaderSize + i * sizeof(d), sizeof(d));
+			if (d < 0 || (d > 0 && count > maxCount / static_cast<std::uint64_t>(d))) {
+				invalid();
+			}
+			count *= static_cast<std::uint64_t>(d);
+			dims[i] = static_cast<mint>(d);
+		}
+		ArrayFileHeader header {static_cast<numericarray_data_t>(typeCode), MArrayDimensions {dims}, sizeForRank(static_cast<mint>(rank))};
+		const std::size_t dataSize = static_cast<std::size_t>(count) * elemSize;
+		if (header.dataOffset > size || dataSize > size - header.dataOffset) {
+			invalid();
+		}
+		return header;
+	}
+
+	std::size_t ArrayFileHeader::sizeForRank(mint rank) noexcept {
+		const std::size_t bytes = fixedHeaderSize + static_cast<std::size_t>(rank) * sizeof(std::int64_t);
+		return (bytes + Alignment - 1) / Alignment * Alignment;
+	}
+
+	void ArrayFileHeader::write(const MappedFile& file) const {
+		if (file.size() < sizeForRank(dims.rank())) {
+			ErrorManager::throwException(ErrorName::InvalidArrayFileHeader, file.fileName());
+		}
+		std::byte* p = file.data();
+		std::memcpy(p, arrayFileMagic.data(), arrayFileMagic.size());
+		p[4] = std::byte {arrayFileVersion};
+		p[5] = std::byte {0};
+		const auto typeCode = static_cast<std::uint16_t>(type);
+		const auto rank = static_cast<std::int64_t>(dims.rank());
+		std::memcpy(p + 6, &typeCode, sizeof(typeCode));
+		std::memcpy(p + 8, &rank, sizeof(rank));
+		for (mint i = 0; i < dims.rank(); ++i) {
+			const auto d = static_cast<std::int64_t>(dims.get(i));
+			std::memcpy(p + fixedHeaderSize + static_cast<std::size_t>(i) * sizeof(d), &d, sizeof(d));
+		}
+	}
+
+}  // namespace LLU
@@ -0,0 +1,61 @@
+/**
+ * @file	SparseArray.cpp
+ * @brief	Implementation of non-template member functions of GenericSparseArray
+ *
+ */
+
+#include "LLU/Containers/SparseArray.h"
+
+namespace LLU {
+
+	MContainer<MArgumentType::SparseArray>::MContainer(const GenericTensor& positions, const GenericTensor& values, const GenericTensor& dimensions,
+													   const GenericTensor& implicitValue) {
+		Container tmp {};
+		if (0 != LibraryData::SparseArrayAPI()->MSparseArray_fromExplicitPositions(positions.getContainer(), values.getContainer(),
+																					dimensions.getContainer(), implicitValue.getContainer(), &tmp)) {
+			ErrorManager::throwException(ErrorName::SparseArrayFromPositionsError);
+		}
+		this->reset(tmp);
+	}
+
+	MContainer<MArgumentType::SparseArray>::MContainer(const GenericTensor& data, const GenericTensor& implicitValue) {
+		Container tmp {};
+		if (0 != LibraryData::SparseArrayAPI()->MSparseArray_fromMTensor(data.getContainer(), implicitValue.getContainer(), &tmp)) {
+			ErrorManager::throwException(ErrorName::SparseArrayFromTensorError);
+		}
+		this->reset(tmp);
+	}
+
+	GenericTensor GenericSparseArray::getExplicitPositions() const {
+		MTensor tmp {};
+		if (0 != LibraryData::SparseArrayAPI()->MSparseArray_getExplicitPositions(this->getContainer(), &tmp)) {
+			ErrorManager::throwException(ErrorName::SparseArrayExplicitPositionsError);
+		}
+		return {tmp, Ownership::Library};
+	}
+
+	GenericTensor GenericSparseArray::toGenericTensor() const {
+		MTensor tmp {};
+		if (0 != LibraryData::SparseArrayAPI()->MSparseArray_toMTensor(this->getContainer(), &tmp)) {
+			ErrorManager::throwException(ErrorName::SparseArrayToTensorError);
+		}
+		return {tmp, Ownership::Library};
+	}
+
+	void GenericSparseArray::resetImplicitValue(const GenericTensor& implicitValue) {
+		Container tmp {};
+		if (0 != LibraryData::SparseArrayAPI()->MSparseArray_resetImplicitValue(this->getContainer(), implicitValue.getContainer(), &tmp)) {
+			ErrorManager::throwException(ErrorName::SparseArrayImplicitValueResetError);
+		}
+		this->reset(tmp);
+	}
+
+	auto GenericSparseArray::cloneImpl() const -> Container {
+		Container tmp {};
+		if (0 != LibraryData::SparseArrayAPI()->MSparseArray_clone(this->getContainer(), &tmp)) {
+			ErrorManager::throwException(ErrorName::SparseArrayCloneError);
+		}
+		return tmp;
+	}
+
+} /* namespace LLU */
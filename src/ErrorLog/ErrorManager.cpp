@@ -60,6 +60,15 @@ namespace LLU {
 			{ErrorName::ImageSizeError, "An error was caused by an incorrect Image size."},
 			{ErrorName::ImageIndexError, "An error was caused by attempting to access a nonexistent Image element."},
 
+			// MSparseArray errors:
+			{ErrorName::SparseArrayCloneError, "Failed to clone MSparseArray."},
+			{ErrorName::SparseArrayTypeError, "An error was caused by an MSparseArray type mismatch."},
+			{ErrorName::SparseArrayFromPositionsError, "Failed to create MSparseArray from explicit positions."},
+			{ErrorName::SparseArrayFromTensorError, "Failed to create MSparseArray from dense MTensor."},
+			{ErrorName::SparseArrayImplicitValueResetError, "Failed to reset the implicit value of MSparseArray."},
+			{ErrorName::SparseArrayExplicitPositionsError, "Failed to get explicit positions of MSparseArray."},
+			{ErrorName::SparseArrayToTensorError, "Failed to convert MSparseArray to dense MTensor."},
+
 			// General container errors:
 			{ErrorName::CreateFromNullError, "Attempting to create a generic container from nullptr."},
 			{ErrorName::MArrayElementIndexError, "Attempting to access MArray element at invalid index."},
@@ -94,6 +103,8 @@ namespace LLU {
 			{ErrorName::DLGetNodeDataError, "DataStoreNode_getData failed"},
 			{ErrorName::DLSharedDataStore, "Trying to create a Shared DataStore. DataStore can only be passed as Automatic or Manual."},
 			{ErrorName::DLPushBackTypeError, "Element to be added to the DataList has incorrect type"},
+			{ErrorName::DLIndexError, "Trying to access non-existing DataList node"},
+			{ErrorName::DLMissingNode, "DataList has no node named `n` required by the decoded type."},
 
 			// MArgument errors:
 			{ErrorName::ArgumentCreateNull, "Trying to create PrimitiveWrapper object from nullptr"},
@@ -111,6 +122,12 @@ namespace LLU {
 			{ErrorName::PathNotValidated, "File path `path` could not be validated under desired open mode."},
 			{ErrorName::InvalidOpenMode, "Specified open mode is invalid."},
 			{ErrorName::OpenFileFailed,	"Could not open file `f`."},
+			{ErrorName::MapFileFailed, "Could not map file `f` into memory."},
+			{ErrorName::InvalidArrayFileHeader, "File `f` does not start with a valid array header."},
+			{ErrorName::ReadFileFailed, "Could not read from file."},
+			{ErrorName::WriteFileFailed, "Could not write to file."},
+			{ErrorName::ChecksumMismatch, "Checksum of block `b` in file `f` does not match its contents."},
+			{ErrorName::DecompressionFailed, "Compressed data is corrupted."},
 		});
 		return errMap;
 	}
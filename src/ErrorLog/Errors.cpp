@@ -50,6 +50,15 @@ namespace LLU::ErrorName {
 	LLU_DEFINE_ERROR_NAME(ImageSizeError);
 	LLU_DEFINE_ERROR_NAME(ImageIndexError);
 
+	// MSparseArray errors:
+	LLU_DEFINE_ERROR_NAME(SparseArrayCloneError);
+	LLU_DEFINE_ERROR_NAME(SparseArrayTypeError);
+	LLU_DEFINE_ERROR_NAME(SparseArrayFromPositionsError);
+	LLU_DEFINE_ERROR_NAME(SparseArrayFromTensorError);
+	LLU_DEFINE_ERROR_NAME(SparseArrayImplicitValueResetError);
+	LLU_DEFINE_ERROR_NAME(SparseArrayExplicitPositionsError);
+	LLU_DEFINE_ERROR_NAME(SparseArrayToTensorError);
+
 	LLU_DEFINE_ERROR_NAME(CreateFromNullError);
 	LLU_DEFINE_ERROR_NAME(MArrayElementIndexError);
 	LLU_DEFINE_ERROR_NAME(MArrayDimensionIndexError);
@@ -81,6 +90,8 @@ namespace LLU::ErrorName {
 	LLU_DEFINE_ERROR_NAME(DLGetNodeDataError);
 	LLU_DEFINE_ERROR_NAME(DLSharedDataStore);
 	LLU_DEFINE_ERROR_NAME(DLPushBackTypeError);
+	LLU_DEFINE_ERROR_NAME(DLIndexError);
+	LLU_DEFINE_ERROR_NAME(DLMissingNode);
 
 	LLU_DEFINE_ERROR_NAME(ArgumentCreateNull);
 	LLU_DEFINE_ERROR_NAME(ArgumentAddNodeMArgument);
@@ -94,5 +105,11 @@ namespace LLU::ErrorName {
 	LLU_DEFINE_ERROR_NAME(PathNotValidated);
 	LLU_DEFINE_ERROR_NAME(InvalidOpenMode);
 	LLU_DEFINE_ERROR_NAME(OpenFileFailed);
+	LLU_DEFINE_ERROR_NAME(MapFileFailed);
+	LLU_DEFINE_ERROR_NAME(InvalidArrayFileHeader);
+	LLU_DEFINE_ERROR_NAME(ReadFileFailed);
+	LLU_DEFINE_ERROR_NAME(WriteFileFailed);
+	LLU_DEFINE_ERROR_NAME(ChecksumMismatch);
+	LLU_DEFINE_ERROR_NAME(DecompressionFailed);
 	/// @endcond
 }	 // namespace LLU::ErrorName
@@ -8,9 +8,16 @@
 #include "LLU/FileUtilities.h"
 
 #ifdef _WIN32
+#include <io.h>
 #include <share.h>
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
 #endif
 
+#include <algorithm>
+
 #include "LLU/ErrorLog/ErrorManager.h"
 #include "LLU/LibraryData.h"
 #include "LLU/Utilities.hpp"
@@ -112,4 +119,77 @@ namespace LLU {
 		return openFileStream<char>(fileName, mode, shp);
 	}
 
+	std::size_t readAt(std::FILE* file, void* buffer, std::size_t count, std::uint64_t offset) {
+		auto* bytes = static_cast<char*>(buffer);
+		std::size_t done = 0;
+		while (done < count) {
+#ifdef _WIN32
+			OVERLAPPED position {};
+			position.Offset = static_cast<DWORD>(offset + done);
+			position.OffsetHigh = static_cast<DWORD>((offset + done) >> 32U);
+			DWORD bytesRead = 0;
+			const auto chunk = static_cast<DWORD>(std::min<std::size_t>(count - done, 1U << 30U));
+			// NOLINTNEXTLINE(performance-no-int-to-ptr): HANDLE is returned from _get_osfhandle as an integer
+			auto handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(file)));
+			if (!ReadFile(handle, bytes + done, chunk, &bytesRead, &position)) {
+				if (GetLastError() == ERROR_HANDLE_EOF) {
+					break;
+				}
+				ErrorManager::throwException(ErrorName::ReadFileFailed);
+			}
+			const auto n = static_cast<std::ptrdiff_t>(bytesRead);
+#else
+			const auto n = pread(fileno(file), bytes + done, count - done, static_cast<off_t>(offset + done));
+			if (n < 0) {
+				ErrorManager::throwException(ErrorName::ReadFileFailed);
+			}
+#endif
+			if (n == 0) {
+				break;
+			}
+			done += static_cast<std::size_t>(n);
+		}
+		return done;
+	}
+
+	void writeAt(std::FILE* file, const void* buffer, std::size_t count, std::uint64_t offset) {
+		const auto* bytes = static_cast<const char*>(buffer);
+		std::size_t done = 0;
+		while (done < count) {
+#ifdef _WIN32
+			OVERLAPPED position {};
+			position.Offset = static_cast<DWORD>(offset + done);
+			position.OffsetHigh = static_cast<DWORD>((offset + done) >> 32U);
+			DWORD bytesWritten = 0;
+			const auto chunk = static_cast<DWORD>(std::min<std::size_t>(count - done, 1U << 30U));
+			// NOLINTNEXTLINE(performance-no-int-to-ptr): HANDLE is returned from _get_osfhandle as an integer
+			auto handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(file)));
+			if (!WriteFile(handle, bytes + done, chunk, &bytesWritten, &position) || bytesWritten == 0) {
+				ErrorManager::throwException(ErrorName::WriteFileFailed);
+			}
+			done += bytesWritten;
+#else
+			const auto n = pwrite(fileno(file), bytes + done, count - done, static_cast<off_t>(offset + done));
+			if (n <= 0) {
+				ErrorManager::throwException(ErrorName::WriteFileFailed);
+			}
+			done += static_cast<std::size_t>(n);
+#endif
+		}
+	}
+
+	std::uint64_t fileSize(std::FILE* file) {
+#ifdef _WIN32
+		struct _stat64 info {};
+		const bool statQ = _fstat64(_fileno(file), &info) == 0;
+#else
+		struct stat info {};
+		const bool statQ = fstat(fileno(file), &info) == 0;
+#endif
+		if (!statQ || info.st_size < 0) {
+			ErrorManager::throwException(ErrorName::ReadFileFailed);
+		}
+		return static_cast<std::uint64_t>(info.st_size);
+	}
+
 }  // namespace LLU
\ No newline at end of file
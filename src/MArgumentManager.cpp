@@ -114,6 +114,10 @@ namespace LLU {
 		return MArgument_getMImage(getArgs(index));
 	}
 
+	MSparseArray MArgumentManager::getMSparseArray(size_type index) const {
+		return MArgument_getMSparseArray(getArgs(index));
+	}
+
 	DataStore MArgumentManager::getDataStore(size_type index) const {
 		//NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast): c-style cast used in a macro in WolframIOLibraryFunctions.h
 		return MArgument_getDataStore(getArgs(index));
@@ -5,13 +5,22 @@
  * @brief	Source code for unit tests of DataStore and its wrapper DataList<T>.
  */
 
+#include <chrono>
 #include <iostream>
 #include <list>
+#include <numeric>
 #include <string>
 
 #include "wstp.h"
 
+#include <LLU/Async/ThreadPool.h>
+#include <LLU/Containers/DataListProfile.hpp>
+#include <LLU/Containers/DataListSchema.hpp>
+#include <LLU/Containers/DataListStream.hpp>
+#include <LLU/Containers/DataTable.hpp>
 #include <LLU/Containers/Iterators/DataList.hpp>
+#include <LLU/Containers/NodePayloads.hpp>
+#include <LLU/Containers/PackedStrings.hpp>
 #include <LLU/LLU.h>
 #include <LLU/LibraryLinkFunctionMacro.h>
 #include <LLU/Utilities.hpp>
@@ -468,4 +477,304 @@ LLU_LIBRARY_FUNCTION(FromInitList) {
 	res.push_back(DataList<LLU::NodeType::UTF8String> {{"a","x"},{"b","y"}});
 
 	mngr.set(res);
-}
\ No newline at end of file
+}
+/* Sum integer nodes of a DataList, with node types validated eagerly (0), on access (1) or not at all (2) */
+LLU_LIBRARY_FUNCTION(SumIntegers) {
+	auto validation = static_cast<LLU::DataListValidation>(mngr.getInteger<mint>(1));
+	auto dsIn = mngr.getDataList<mint>(0, validation);
+	mint total = 0;
+	for (auto [name, value] : dsIn) {
+		total += value;
+	}
+	mngr.set(total);
+}
+
+/* Look up integer nodes by name, -1 marks names that are not in the DataList */
+LLU_LIBRARY_FUNCTION(ValuesByName) {
+	auto dsIn = mngr.getDataList<mint>(0);
+	auto names = mngr.getDataList<std::string_view>(1);
+	LLU::Tensor<mint> res(0, {names.length()});
+	std::transform(names.valueBegin(), names.valueEnd(), res.begin(), [&dsIn](std::string_view name) {
+		auto node = dsIn.find(name);
+		return node != dsIn.end() ? (*node).value() : -1;
+	});
+	mngr.set(res);
+}
+
+/* Get integer node at given position, counting from 0 */
+LLU_LIBRARY_FUNCTION(ValueAt) {
+	auto dsIn = mngr.getDataList<mint>(0);
+	mngr.set(dsIn.at(mngr.getInteger<mint>(1)));
+}
+
+/* Build a DataList of integers 1, ..., n with push_back (0), fromRange (1) or packed into a single NumericArray node (2) */
+LLU_LIBRARY_FUNCTION(BuildIntegers) {
+	auto n = mngr.getInteger<mint>(0);
+	auto mode = mngr.getInteger<mint>(1);
+	std::vector<mint> values(static_cast<std::size_t>(n));
+	std::iota(values.begin(), values.end(), 1);
+	if (mode == 0) {
+		DataList<mint> res;
+		for (auto v : values) {
+			res.push_back(v);
+		}
+		mngr.set(res);
+	} else if (mode == 1) {
+		mngr.set(DataList<mint>::fromRange(values.begin(), values.end()));
+	} else {
+		mngr.set(LLU::packedDataList(values.begin(), values.end(), "Values"));
+	}
+}
+
+/* Zip a list of names with a list of reals into a DataList with named nodes */
+LLU_LIBRARY_FUNCTION(ZipNamesAndValues) {
+	auto names = mngr.getDataList<std::string_view>(0);
+	auto values = mngr.getTensor<double>(1);
+	auto keys = names.values();
+	mngr.set(DataList<double>::fromNamedRange(keys.begin(), keys.end(), values.begin()));
+}
+
+/* Sum elements of each "Real64" NumericArray in a DataList, processing the arrays on given number of threads */
+LLU_LIBRARY_FUNCTION(ParallelArrayTotals) {
+	auto dsIn = mngr.getDataList<LLU::NodeType::NumericArray>(0);
+	auto threads = static_cast<unsigned>(std::max(mngr.getInteger<mint>(1), mint {1}));
+	LLU::NodePayloads<LLU::NumericArrayTypedView<double>> arrays {dsIn};
+	LLU::ThreadPool pool {threads};
+	auto totals = arrays.transform(pool, [](const auto& na) { return std::accumulate(na.begin(), na.end(), 0.0); }, threads);
+	mngr.set(LLU::Tensor<double>(totals.begin(), totals.end(), {static_cast<mint>(totals.size())}));
+}
+
+/* Find the largest element of each "Real64" NumericArray in a DataList, returning a DataList of maxima under the same names */
+LLU_LIBRARY_FUNCTION(ParallelMaxima) {
+	auto dsIn = mngr.getDataList<LLU::NodeType::NumericArray>(0);
+	LLU::NodePayloads<LLU::NumericArrayTypedView<double>> arrays {dsIn};
+	LLU::ThreadPool pool;
+	auto dsOut = arrays.transformToDataList<double>(pool, [](const auto& na) { return *std::max_element(na.begin(), na.end()); });
+	mngr.set(dsOut);
+}
+
+struct Particle {
+	std::string name;
+	double mass = 0.;
+	int charge = 0;
+	std::vector<double> position;
+};
+
+struct ParticleSystem {
+	std::string title;
+	std::vector<Particle> particles;
+};
+
+template<>
+struct LLU::DataListSchema<Particle> {
+	static constexpr auto fields = std::make_tuple(LLU::schemaField("Name", &Particle::name), LLU::schemaField("Mass", &Particle::mass),
+												   LLU::schemaField("Charge", &Particle::charge), LLU::schemaField("Position", &Particle::position));
+};
+
+template<>
+struct LLU::DataListSchema<ParticleSystem> {
+	static constexpr auto fields = std::make_tuple(LLU::schemaField("Title", &ParticleSystem::title), LLU::schemaField("Particles", &ParticleSystem::particles));
+};
+
+/* Decode a system of particles, move each particle by given vector and return the new system */
+LLU_LIBRARY_FUNCTION(MoveParticles) {
+	auto system = LLU::fromDataList<ParticleSystem>(mngr.getGenericDataList(0));
+	auto shift = mngr.getTensor<double>(1);
+	for (auto& p : system.particles) {
+		std::transform(p.position.begin(), p.position.end(), shift.begin(), p.position.begin(), std::plus<>());
+	}
+	system.title += " (moved)";
+	mngr.set(LLU::toDataList(system));
+}
+
+/* Get the total mass of particles, decoding each particle separately with one DataListDecoder */
+LLU_LIBRARY_FUNCTION(TotalMass) {
+	auto particles = mngr.getDataList<LLU::NodeType::DataStore>(0);
+	LLU::DataListDecoder<Particle> decoder;
+	double total = 0.;
+	for (auto p : LLU::ValueAdaptor<LLU::NodeType::DataStore> {particles}) {
+		total += decoder.decode(p).mass;
+	}
+	mngr.set(total);
+}
+
+/* Get the total mass of particles that have all fields, the same DataListDecoder is used after particles with missing fields */
+LLU_LIBRARY_FUNCTION(TotalValidMass) {
+	auto particles = mngr.getDataList<LLU::NodeType::DataStore>(0);
+	LLU::DataListDecoder<Particle> decoder;
+	double total = 0.;
+	for (auto p : LLU::ValueAdaptor<LLU::NodeType::DataStore> {particles}) {
+		try {
+			total += decoder.decode(p).mass;
+		} catch (const LLU::LibraryLinkError& e) {
+			if (e.name() != LLU::ErrorName::DLMissingNode) {
+				throw;
+			}
+		}
+	}
+	mngr.set(total);
+}
+
+/* Concatenate two DataLists by moving the nodes of both into a new one, appending the result to itself must leave it unchanged */
+LLU_LIBRARY_FUNCTION(AppendDataLists) {
+	auto first = mngr.getDataList<LLU::NodeType::Any>(0);
+	auto second = mngr.getDataList<LLU::NodeType::Any>(1);
+	LLU::DataList<LLU::NodeType::Any> result;
+	result.append(std::move(first));
+	result.append(std::move(second));
+	result.append(std::move(result));
+	mngr.set(result);
+}
+
+/* Nest a DataList in a new one together with a copy of the value of its node with given name */
+LLU_LIBRARY_FUNCTION(SpliceAndExtract) {
+	auto list = mngr.getDataList<LLU::NodeType::Any>(0);
+	auto name = mngr.getString(1);
+	auto extracted = list.extract(name);
+	LLU::DataList<LLU::NodeType::DataStore> result;
+	result.splice("list", std::move(list));
+	if (extracted) {
+		LLU::DataList<LLU::NodeType::Any> node;
+		node.push_back(name, std::move(*extracted));
+		result.splice("extracted", std::move(node));
+	}
+	mngr.set(result);
+}
+
+namespace {
+	/* Build a DataList of nested DataLists, each of them holding one "Real64" NumericArray of given length */
+	LLU::DataList<LLU::NodeType::DataStore> nestedArrays(mint count, mint length) {
+		LLU::DataList<LLU::NodeType::DataStore> result;
+		for (mint i = 0; i < count; ++i) {
+			LLU::DataList<LLU::NodeType::NumericArray> nested;
+			nested.push_back("data", LLU::NumericArray<double>(static_cast<double>(i), LLU::MArrayDimensions {length}));
+			result.splice("part" + std::to_string(i), std::move(nested));
+		}
+		return result;
+	}
+}  // namespace
+
+/* Measure the time of concatenating two DataLists of nested DataLists with large arrays, either by cloning the first one and pushing copies of
+ * the nodes of the second one (mode 0) or with append (mode 1). Returns the time and the length of the result. */
+LLU_LIBRARY_FUNCTION(ConcatenateTiming) {
+	auto count = mngr.getInteger<mint>(0);
+	auto length = mngr.getInteger<mint>(1);
+	auto mode = mngr.getInteger<mint>(2);
+	auto first = nestedArrays(count, length);
+	auto second = nestedArrays(count, length);
+	auto start = std::chrono::steady_clock::now();
+	LLU::DataList<LLU::NodeType::DataStore> result;
+	if (mode == 0) {
+		result = first.clone();
+		for (auto node : second) {
+			result.push_back(node.name(), node.value().clone());
+		}
+	} else {
+		first.append(std::move(second));
+		result = std::move(first);
+	}
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	mngr.set(LLU::Tensor<double> {elapsed.count(), static_cast<double>(result.length())});
+}
+
+/* Build a table of query results with given number of rows, either as a DataList of rows (mode 0) or as a columnar DataTable (mode 1) */
+LLU_LIBRARY_FUNCTION(BuildQueryResult) {
+	auto rows = mngr.getInteger<mint>(0);
+	if (mngr.getInteger<mint>(1) == 0) {
+		LLU::DataList<LLU::NodeType::DataStore> result;
+		for (mint i = 0; i < rows; ++i) {
+			LLU::DataList<LLU::NodeType::Any> row;
+			row.push_back("id", i);
+			row.push_back("score", static_cast<double>(i) / 2);
+			row.push_back("name", std::string_view {"row" + std::to_string(i)});
+			result.push_back(std::move(row));
+		}
+		mngr.set(result);
+	} else {
+		LLU::DataTableBuilder<mint, double, std::string> table {{"id", "score", "name"}, rows};
+		for (mint i = 0; i < rows; ++i) {
+			table.addRow(i, static_cast<double>(i) / 2, "row" + std::to_string(i));
+		}
+		mngr.set(std::move(table).toDataList());
+	}
+}
+
+/* Read the "score" and "name" columns of a table and return the total score and the name of the row with the highest score */
+LLU_LIBRARY_FUNCTION(BestScore) {
+	auto table = mngr.getGenericDataList(0);
+	LLU::DataTableReader<double, std::string> reader {table, {"score", "name"}};
+	double total = 0.;
+	mint bestRow = -1;
+	for (mint i = 0; i < reader.rowCount(); ++i) {
+		total += reader.get<0>(i);
+		if (bestRow < 0 || reader.get<0>(i) > reader.get<0>(bestRow)) {
+			bestRow = i;
+		}
+	}
+	LLU::DataList<LLU::NodeType::Any> result;
+	result.push_back("Total", total);
+	result.push_back("Best", bestRow < 0 ? std::string_view {""} : reader.get<1>(bestRow));
+	mngr.set(result);
+}
+
+/* Split a string into words separated by spaces and return them packed */
+LLU_LIBRARY_FUNCTION(SplitWords) {
+	auto text = mngr.getString(0);
+	std::vector<std::string_view> words;
+	std::string_view rest {text};
+	while (!rest.empty()) {
+		auto end = std::min(rest.find(' '), rest.size());
+		if (end > 0) {
+			words.push_back(rest.substr(0, end));
+		}
+		rest.remove_prefix(std::min(end + 1, rest.size()));
+	}
+	mngr.set(LLU::PackedStrings::fromRange(words.begin(), words.end()).toDataList());
+}
+
+/* Get the longest of packed strings passed as two NumericArrays, bytes and offsets */
+LLU_LIBRARY_FUNCTION(LongestString) {
+	auto strings = mngr.get<LLU::PackedStrings>(0);
+	std::string_view longest {""};
+	for (auto s : strings) {
+		if (s.size() > longest.size()) {
+			longest = s;
+		}
+	}
+	mngr.set(std::string {longest});
+}
+
+/* Return strings "s0", "s1", ... either as a DataList of strings (mode 0) or packed (mode 1) */
+LLU_LIBRARY_FUNCTION(ReturnStrings) {
+	auto n = mngr.getInteger<mint>(0);
+	std::vector<std::string> strings;
+	strings.reserve(static_cast<std::size_t>(n));
+	for (mint i = 0; i < n; ++i) {
+		strings.push_back("s" + std::to_string(i));
+	}
+	if (mngr.getInteger<mint>(1) == 0) {
+		mngr.set(LLU::DataList<LLU::NodeType::UTF8String>::fromRange(strings.begin(), strings.end()));
+	} else {
+		mngr.set(LLU::PackedStrings::fromRange(strings.begin(), strings.end()).toDataList());
+	}
+}
+
+/* Profile a DataList and return the number of all nodes, their payload bytes and the depth of the deepest nested DataList */
+LLU_LIBRARY_FUNCTION(ProfileSummary) {
+	auto profile = LLU::profileDataList(mngr.getGenericDataList<LLU::Passing::Constant>(0));
+	mngr.set(LLU::Tensor<mint> {profile.totalNodes(), profile.totalBytes(), profile.maxDepth});
+}
+
+/* Stream integers 0, 1, ..., n - 1 to the Kernel in chunks of given size, the producer stops with DLIndexError at position given by the third argument */
+LLU_LIBRARY_FUNCTION(StreamRange) {
+	auto n = mngr.getInteger<mint>(0);
+	auto failAt = mngr.getInteger<mint>(2);
+	mngr.set(LLU::startDataListStream<mint>(mngr.getInteger<mint>(1), [n, failAt](LLU::DataListStream<mint>& stream) {
+		for (mint i = 0; i < n && stream.alive(); ++i) {
+			if (i == failAt) {
+				LLU::ErrorManager::throwException(LLU::ErrorName::DLIndexError);
+			}
+			stream.push_back(i);
+		}
+	}));
+}
@@ -0,0 +1,60 @@
+#include <algorithm>
+#include <chrono>
+#include <type_traits>
+
+#include <LLU/Async/ThreadPool.h>
+#include <LLU/Containers/ImageLayout.hpp>
+#include <LLU/LLU.h>
+#include <LLU/LibraryLinkFunctionMacro.h>
+
+namespace {
+	unsigned threadCount(mint requested) {
+		return requested > 0 ? static_cast<unsigned>(requested) : std::max(std::thread::hardware_concurrency(), 1U);
+	}
+}  // namespace
+
+/* Copy an image with given interleaving, using a thread pool with given number of threads, or sequentially if it is 1 */
+LLU_LIBRARY_FUNCTION(ChangeInterleaving) {
+	auto interleaved = mngr.getBoolean(1);
+	auto threads = mngr.getInteger<mint>(2);
+	mngr.operateOnImage<LLU::Passing::Constant>(0, [&](auto&& im) {
+		if (threads == 1) {
+			mngr.setImage(LLU::Layout::withLayout(im, interleaved));
+		} else {
+			LLU::ThreadPool tp {threadCount(threads)};
+			mngr.setImage(LLU::Layout::withLayout(tp, im, interleaved, 4 * threadCount(threads)));
+		}
+	});
+}
+
+/* Convert the layout of the first "Byte" image into a copy of the second one */
+LLU_LIBRARY_FUNCTION(ConvertIntoImage) {
+	auto src = mngr.getImage<uint8_t, LLU::Passing::Constant>(0);
+	auto dst = mngr.getImage<uint8_t, LLU::Passing::Constant>(1).clone();
+	LLU::Layout::convertLayout(src, dst);
+	mngr.setImage(dst);
+}
+
+/* Average time in seconds of changing the interleaving of an image with MImage_convertType (method 0), LLU sequentially (1) or on a thread pool (2) */
+LLU_LIBRARY_FUNCTION(InterleavingTiming) {
+	auto method = mngr.getInteger<mint>(1);
+	auto repetitions = std::max(mngr.getInteger<mint>(2), mint {1});
+	mngr.operateOnImage<LLU::Passing::Constant>(0, [&](auto&& im) {
+		using T = typename std::remove_reference_t<decltype(im)>::value_type;
+		const bool interleaved = !im.interleavedQ();
+		LLU::ThreadPool tp {threadCount(0)};
+		auto dst = LLU::Layout::withLayout(im, interleaved);
+		auto start = std::chrono::steady_clock::now();
+		for (mint i = 0; i < repetitions; ++i) {
+			if (method == 0) {
+				auto res = im.template convert<T>(interleaved);
+			} else if (method == 1) {
+				LLU::Layout::convertLayout(im, dst);
+			} else {
+				LLU::Layout::convertLayout(tp, im, dst);
+			}
+		}
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		mngr.set(elapsed.count() / static_cast<double>(repetitions));
+	});
+}
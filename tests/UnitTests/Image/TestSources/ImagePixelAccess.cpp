@@ -0,0 +1,118 @@
+#include <algorithm>
+#include <chrono>
+#include <type_traits>
+
+#include <LLU/LLU.h>
+#include <LLU/LibraryLinkFunctionMacro.h>
+
+/* Check that ImageAccessor sees the same values as TypedImage::get for every channel of every pixel */
+LLU_LIBRARY_FUNCTION(AccessorMatchesGet) {
+	mngr.operateOnImage<LLU::Passing::Constant>(0, [&mngr](auto&& im) {
+		using T = typename std::remove_reference_t<decltype(im)>::value_type;
+		LLU::ImageAccessor<const T> pixels {im};
+		bool result = true;
+		for (mint slice = 0; slice < pixels.slices(); ++slice) {
+			for (mint row = 0; row < pixels.rows(); ++row) {
+				for (mint col = 0; col < pixels.columns(); ++col) {
+					for (mint ch = 0; ch < pixels.channels(); ++ch) {
+						auto expected = im.is3D() ? im.get(slice + 1, row + 1, col + 1, ch + 1) : im.get(row + 1, col + 1, ch + 1);
+						result = result && (pixels(slice, row, col, ch) == expected);
+					}
+				}
+			}
+		}
+		mngr.set(result);
+	});
+}
+
+/* Return values of a single channel (1-based index) of a "Byte" image as a flat list */
+LLU_LIBRARY_FUNCTION(ChannelValues) {
+	auto im = mngr.getImage<uint8_t, LLU::Passing::Constant>(0);
+	auto channel = mngr.getInteger<mint>(1);
+	LLU::ImageAccessor<const uint8_t> pixels {im};
+	auto range = pixels.channel(channel - 1);
+	LLU::Tensor<mint> out(0, {range.size()});
+	std::copy(range.begin(), range.end(), out.begin());
+	mngr.set(out);
+}
+
+/* Mirror an image horizontally by reversing every row of every channel */
+LLU_LIBRARY_FUNCTION(ReverseRows) {
+	mngr.operateOnImage<LLU::Passing::Constant>(0, [&mngr](auto&& in) {
+		using T = typename std::remove_reference_t<decltype(in)>::value_type;
+		auto out = in.clone();
+		LLU::ImageAccessor<T> pixels {out};
+		for (mint slice = 0; slice < pixels.slices(); ++slice) {
+			for (mint ch = 0; ch < pixels.channels(); ++ch) {
+				for (mint row = 0; row < pixels.rows(); ++row) {
+					auto r = pixels.row(row, ch, slice);
+					std::reverse(r.begin(), r.end());
+				}
+			}
+		}
+		mngr.setImage(out);
+	});
+}
+
+/* Add given value to every element of one channel in one slice of a 3D "Real32" image */
+LLU_LIBRARY_FUNCTION(ShiftPlane) {
+	auto im = mngr.getImage<float, LLU::Passing::Constant>(0);
+	auto channel = mngr.getInteger<mint>(1);
+	auto slice = mngr.getInteger<mint>(2);
+	auto shift = static_cast<float>(mngr.getReal(3));
+	auto out = im.clone();
+	LLU::ImageAccessor<float> pixels {out};
+	for (auto& v : pixels.plane(channel - 1, slice - 1)) {
+		v += shift;
+	}
+	mngr.setImage(out);
+}
+
+namespace {
+	/* Negate a "Byte" image pixel by pixel, either with ImageAccessor or with TypedImage::get/set */
+	void negatePixels(const LLU::Image<uint8_t>& in, LLU::Image<uint8_t>& out, bool useAccessor) {
+		const auto rows = in.rows();
+		const auto cols = in.columns();
+		const auto channels = in.channels();
+		if (useAccessor) {
+			LLU::ImageAccessor<const uint8_t> src {in};
+			LLU::ImageAccessor<uint8_t> dst {out};
+			for (mint row = 0; row < rows; ++row) {
+				for (mint col = 0; col < cols; ++col) {
+					for (mint ch = 0; ch < channels; ++ch) {
+						dst(row, col, ch) = static_cast<uint8_t>(255 - src(row, col, ch));
+					}
+				}
+			}
+		} else {
+			for (mint row = 1; row <= rows; ++row) {
+				for (mint col = 1; col <= cols; ++col) {
+					for (mint ch = 1; ch <= channels; ++ch) {
+						out.set(row, col, ch, static_cast<uint8_t>(255 - in.get(row, col, ch)));
+					}
+				}
+			}
+		}
+	}
+}  // namespace
+
+LLU_LIBRARY_FUNCTION(PixelNegate) {
+	auto in = mngr.getImage<uint8_t, LLU::Passing::Constant>(0);
+	auto out = in.clone();
+	negatePixels(in, out, mngr.getBoolean(1));
+	mngr.setImage(out);
+}
+
+/* Average time in seconds of negating an image pixel by pixel */
+LLU_LIBRARY_FUNCTION(PixelNegateTiming) {
+	auto in = mngr.getImage<uint8_t, LLU::Passing::Constant>(0);
+	auto useAccessor = mngr.getBoolean(1);
+	auto repetitions = std::max(mngr.getInteger<mint>(2), mint {1});
+	auto out = in.clone();
+	auto start = std::chrono::steady_clock::now();
+	for (mint i = 0; i < repetitions; ++i) {
+		negatePixels(in, out, useAccessor);
+	}
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	mngr.set(elapsed.count() / static_cast<double>(repetitions));
+}
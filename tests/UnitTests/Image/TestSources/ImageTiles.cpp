@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <chrono>
+#include <type_traits>
+#include <vector>
+
+#include <LLU/Async/ThreadPool.h>
+#include <LLU/Containers/ImageTiles.hpp>
+#include <LLU/LLU.h>
+#include <LLU/LibraryLinkFunctionMacro.h>
+
+namespace {
+	LLU::Tiling::Border borderFromIndex(mint index) {
+		return static_cast<LLU::Tiling::Border>(std::clamp<mint>(index, 0, 3));
+	}
+
+	std::vector<double> weightsFromTensor(const LLU::Tensor<double>& t) {
+		return {t.begin(), t.end()};
+	}
+}  // namespace
+
+/* Separable convolution with given 1D kernel, border policy, tile size {slices, rows, columns} and number of threads (1 means sequential) */
+LLU_LIBRARY_FUNCTION(SeparableConvolve) {
+	auto weights = weightsFromTensor(mngr.getTensor<double, LLU::Passing::Constant>(1));
+	auto border = borderFromIndex(mngr.getInteger<mint>(2));
+	auto tileSize = mngr.getTensor<mint, LLU::Passing::Constant>(3);
+	auto threads = mngr.getInteger<mint>(4);
+	LLU::Tiling::Extent tile {tileSize[0], tileSize[1], tileSize[2]};
+	mngr.operateOnImage<LLU::Passing::Constant>(0, [&](auto&& im) {
+		auto out = im.clone();
+		if (threads == 1) {
+			LLU::Tiling::convolveSeparable(im, out, weights, border, tile);
+		} else {
+			LLU::ThreadPool tp {static_cast<unsigned>(std::max<mint>(threads, 1))};
+			LLU::Tiling::convolveSeparable(tp, im, out, weights, border, tile);
+		}
+		mngr.setImage(out);
+	});
+}
+
+/* Replace every pixel of a "Real32" image by the maximum over a square (or cube) neighbourhood of given radius, computed with a custom tile kernel */
+LLU_LIBRARY_FUNCTION(LocalMaximum) {
+	auto im = mngr.getImage<float, LLU::Passing::Constant>(0);
+	auto radius = mngr.getInteger<mint>(1);
+	LLU::Tiling::Options opts;
+	opts.halo = {radius, radius, radius};
+	opts.border = borderFromIndex(mngr.getInteger<mint>(2));
+	opts.borderValue = mngr.getReal(3);
+	opts.tileSize = {2, 5, 7};
+	const mint sliceRadius = im.is3D() ? radius : 0;
+	auto out = im.clone();
+	LLU::ThreadPool tp {3};
+	LLU::Tiling::forEachTile(tp, im, out, opts, [radius, sliceRadius](const LLU::Tiling::Tile<float>& tile, const LLU::ImageAccessor<float>& dst) {
+		const auto& origin = tile.region().origin;
+		for (mint ch = 0; ch < tile.channels(); ++ch) {
+			for (mint z = 0; z < tile.slices(); ++z) {
+				for (mint y = 0; y < tile.rows(); ++y) {
+					for (mint x = 0; x < tile.columns(); ++x) {
+						float m = tile(z, y, x, ch);
+						for (mint dz = -sliceRadius; dz <= sliceRadius; ++dz) {
+							for (mint dy = -radius; dy <= radius; ++dy) {
+								for (mint dx = -radius; dx <= radius; ++dx) {
+									m = std::max(m, tile(z + dz, y + dy, x + dx, ch));
+								}
+							}
+						}
+						dst(origin.slices + z, origin.rows + y, origin.columns + x, ch) = m;
+					}
+				}
+			}
+		}
+	});
+	mngr.setImage(out);
+}
+
+/* Pass a convolution kernel of even length to trigger an error */
+LLU_LIBRARY_FUNCTION(EvenKernelConvolution) {
+	auto im = mngr.getImage<float, LLU::Passing::Constant>(0);
+	auto out = im.clone();
+	LLU::Tiling::convolveSeparable(im, out, {0.5, 0.5});
+}
+
+/* Convolve a "Real32" image into a single-channel image to trigger an error when the source has more channels, sequentially or on a thread pool */
+LLU_LIBRARY_FUNCTION(ChannelMismatchConvolution) {
+	auto im = mngr.getImage<float, LLU::Passing::Constant>(0);
+	auto threads = mngr.getInteger<mint>(1);
+	LLU::Image<float> out {im.columns(), im.rows(), 1, MImage_CS_Gray, true};
+	if (threads == 1) {
+		LLU::Tiling::convolveSeparable(im, out, {0.25, 0.5, 0.25});
+	} else {
+		LLU::ThreadPool tp {static_cast<unsigned>(std::max<mint>(threads, 1))};
+		LLU::Tiling::convolveSeparable(tp, im, out, {0.25, 0.5, 0.25});
+	}
+}
+
+/* Average time in seconds of separable convolution of an image with given kernel using given number of threads */
+LLU_LIBRARY_FUNCTION(SeparableConvolveTiming) {
+	auto weights = weightsFromTensor(mngr.getTensor<double, LLU::Passing::Constant>(1));
+	auto threads = std::max<mint>(mngr.getInteger<mint>(2), 1);
+	auto repetitions = std::max(mngr.getInteger<mint>(3), mint {1});
+	mngr.operateOnImage<LLU::Passing::Constant>(0, [&](auto&& im) {
+		auto out = im.clone();
+		LLU::ThreadPool tp {static_cast<unsigned>(threads)};
+		auto start = std::chrono::steady_clock::now();
+		for (mint i = 0; i < repetitions; ++i) {
+			LLU::Tiling::convolveSeparable(tp, im, out, weights, LLU::Tiling::Border::Reflect, LLU::Tiling::DefaultTileSize);
+		}
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		mngr.set(elapsed.count() / static_cast<double>(repetitions));
+	});
+}
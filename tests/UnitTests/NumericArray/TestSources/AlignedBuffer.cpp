@@ -0,0 +1,84 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <numeric>
+
+#include <LLU/Containers/AlignedBuffer.hpp>
+#include <LLU/LLU.h>
+#include <LLU/LibraryLinkFunctionMacro.h>
+
+namespace {
+	constexpr mint Lanes = LLU::AlignedBuffer<double>::Lanes;
+
+	/// Sum of n elements starting at data, the aligned part is summed with independent accumulators which lets the compiler vectorize the loop
+	double peeledTotal(const double* data, mint n) {
+		double scalarSum = 0.0;
+		std::array<double, Lanes> acc {};
+		LLU::alignedLoop<Lanes>(
+			data, n, [&](mint i) { scalarSum += data[i]; },
+			[&](mint i) {
+				for (mint k = 0; k < Lanes; ++k) {
+					acc[k] += data[i + k];
+				}
+			});
+		return std::accumulate(acc.begin(), acc.end(), scalarSum);
+	}
+}  // namespace
+
+/* Sum of elements of a "Real64" NumericArray starting from given (0-based) offset, so that the input is not aligned */
+LLU_LIBRARY_FUNCTION(PeeledTotal) {
+	auto na = mngr.getNumericArray<double, LLU::Passing::Constant>(0);
+	auto offset = std::clamp<mint>(mngr.getInteger<mint>(1), 0, na.size());
+	mngr.set(peeledTotal(na.data() + offset, na.size() - offset));
+}
+
+/* Multiply a "Real64" NumericArray by a constant in an aligned workspace and return the result with the original dimensions */
+LLU_LIBRARY_FUNCTION(AlignedScale) {
+	auto na = mngr.getNumericArray<double, LLU::Passing::Constant>(0);
+	auto factor = mngr.getReal(1);
+	LLU::AlignedBuffer<double> workspace {na};
+	for (auto& v : workspace) {
+		v *= factor;
+	}
+	mngr.set(workspace.toNumericArray(na.dimensions()));
+}
+
+/* Allocate an AlignedBuffer of given number of bytes and return {1 if it is aligned to a cache line, 1 if it is backed by huge pages} */
+LLU_LIBRARY_FUNCTION(AlignedBufferProperties) {
+	auto bytes = mngr.getInteger<mint>(0);
+	auto hugePages = mngr.getBoolean(1) ? LLU::HugePages::Yes : LLU::HugePages::No;
+	LLU::AlignedBuffer<std::uint8_t> buffer {bytes, hugePages};
+	const bool aligned = reinterpret_cast<std::uintptr_t>(buffer.data()) % LLU::CacheLineSize == 0;
+	mngr.set(LLU::Tensor<mint> {aligned ? 1 : 0, buffer.hugePagesQ() ? 1 : 0});
+}
+
+/* Move an AlignedBuffer of given size twice and return {size, element count, 1 if data is null} of both moved-from buffers and the size of the last one */
+LLU_LIBRARY_FUNCTION(AlignedBufferMove) {
+	LLU::AlignedBuffer<double> first {mngr.getInteger<mint>(0), 1};
+	LLU::AlignedBuffer<double> second {std::move(first)};
+	LLU::AlignedBuffer<double> third {1};
+	third = std::move(second);
+	auto state = [](const LLU::AlignedBuffer<double>& b) {
+		return std::array<mint, 3> {b.size(), static_cast<mint>(std::distance(b.begin(), b.end())), b.data() == nullptr ? 1 : 0};
+	};
+	auto [s1, n1, null1] = state(first);
+	auto [s2, n2, null2] = state(second);
+	mngr.set(LLU::Tensor<mint> {s1, n1, null1, s2, n2, null2, third.size()});
+}
+
+/* Average time in seconds of summing a "Real64" NumericArray copied into an AlignedBuffer with given huge page setting, or directly (method 0) */
+LLU_LIBRARY_FUNCTION(PeeledTotalTiming) {
+	auto na = mngr.getNumericArray<double, LLU::Passing::Constant>(0);
+	auto method = mngr.getInteger<mint>(1);
+	auto repetitions = std::max(mngr.getInteger<mint>(2), mint {1});
+	LLU::AlignedBuffer<double> workspace {na, method == 2 ? LLU::HugePages::Yes : LLU::HugePages::No};
+	const double* data = method == 0 ? na.data() : workspace.data();
+	volatile double total = 0.0;
+	auto start = std::chrono::steady_clock::now();
+	for (mint i = 0; i < repetitions; ++i) {
+		total = total + peeledTotal(data, na.size());
+	}
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	mngr.set(elapsed.count() / static_cast<double>(repetitions));
+}
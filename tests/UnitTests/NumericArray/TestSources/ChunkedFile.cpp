@@ -0,0 +1,135 @@
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <vector>
+
+#include <LLU/Async/ThreadPool.h>
+#include <LLU/Containers/ChunkedFile.hpp>
+#include <LLU/LLU.h>
+#include <LLU/LibraryLinkFunctionMacro.h>
+
+/* Store a "Real64" NumericArray in a chunked file with given block size, writing blocks in parallel if the thread count is greater than 1 */
+LLU_LIBRARY_FUNCTION(ChunkedWrite) {
+	auto na = mngr.getNumericArray<double, LLU::Passing::Constant>(0);
+	LLU::ChunkedFileOptions opts;
+	opts.blockSize = static_cast<std::size_t>(mngr.getInteger<mint>(2));
+	opts.checksums = mngr.getBoolean(3);
+	auto threads = mngr.getInteger<mint>(4);
+	LLU::ChunkedFileWriter writer {mngr.getString(1), MNumericArray_Type_Real64, na.dimensions(), opts};
+	if (threads > 1) {
+		LLU::ThreadPool pool {static_cast<unsigned>(threads)};
+		writer.write(na, pool, static_cast<unsigned>(threads));
+	} else {
+		writer.write(na);
+	}
+}
+
+/* Read a chunked file of "Real64" values into a NumericArray, loading blocks in parallel if the thread count is greater than 1 */
+LLU_LIBRARY_FUNCTION(ChunkedRead) {
+	LLU::ChunkedFileReader reader {mngr.getString(0)};
+	auto threads = mngr.getInteger<mint>(1);
+	if (threads > 1) {
+		LLU::ThreadPool pool {static_cast<unsigned>(threads)};
+		mngr.set(reader.read<double>(pool));
+	} else {
+		mngr.set(reader.read<double>());
+	}
+}
+
+/* Sum all elements of a chunked file, block by block, while the next blocks are being read in the background */
+LLU_LIBRARY_FUNCTION(ChunkedStreamTotal) {
+	LLU::ChunkedFileReader reader {mngr.getString(0)};
+	LLU::ThreadPool pool {2};
+	double total = 0.;
+	reader.forEachBlock<double>(pool, [&total](mint /*index*/, const double* data, mint count) {
+		for (mint i = 0; i < count; ++i) {
+			total += data[i];
+		}
+	});
+	mngr.set(total);
+}
+
+/* Measure the time of reading a chunked file into a preallocated NumericArray with given number of threads */
+LLU_LIBRARY_FUNCTION(ChunkedReadTiming) {
+	LLU::ChunkedFileReader reader {mngr.getString(0)};
+	auto threads = mngr.getInteger<mint>(1);
+	auto repetitions = std::max(mngr.getInteger<mint>(2), mint {1});
+	LLU::NumericArray<double> dst {0., reader.dimensions()};
+	LLU::ThreadPool pool {static_cast<unsigned>(std::max(threads, mint {1}))};
+	auto start = std::chrono::steady_clock::now();
+	for (mint r = 0; r < repetitions; ++r) {
+		if (threads > 1) {
+			reader.readInto(dst, pool, static_cast<unsigned>(threads));
+		} else {
+			reader.readInto(dst);
+		}
+	}
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	mngr.set(elapsed.count() / static_cast<double>(repetitions));
+}
+
+/* Store a "Real64" NumericArray in a chunked file with compressed blocks, compressing them on given number of threads */
+LLU_LIBRARY_FUNCTION(CompressedWrite) {
+	auto na = mngr.getNumericArray<double, LLU::Passing::Constant>(0);
+	auto threads = static_cast<unsigned>(std::max(mngr.getInteger<mint>(2), mint {1}));
+	LLU::ChunkedFileOptions opts;
+	opts.blockSize = std::size_t {1} << 18U;
+	opts.compression = LLU::Compression::ShuffleLZ;
+	LLU::ChunkedFileWriter writer {mngr.getString(1), MNumericArray_Type_Real64, na.dimensions(), opts};
+	LLU::ThreadPool pool {threads};
+	writer.write(na, pool, threads);
+}
+
+/* Get the number of bytes that the array data takes in a chunked file */
+LLU_LIBRARY_FUNCTION(ChunkedStoredSize) {
+	LLU::ChunkedFileReader reader {mngr.getString(0)};
+	mngr.set(static_cast<mint>(reader.storedSize()));
+}
+
+/* Sum the elements of a single block of a chunked file, without reading other blocks */
+LLU_LIBRARY_FUNCTION(ChunkedBlockTotal) {
+	LLU::ChunkedFileReader reader {mngr.getString(0)};
+	auto index = mngr.getInteger<mint>(1);
+	std::vector<double> block(reader.header().blockBytes(index) / sizeof(double));
+	reader.readBlock(index, block.data());
+	mngr.set(std::accumulate(block.begin(), block.end(), 0.0));
+}
+
+/* Store a real Tensor in a compressed chunked file and read it back as a new Tensor */
+LLU_LIBRARY_FUNCTION(CompressedTensorRoundTrip) {
+	auto t = mngr.getTensor<double, LLU::Passing::Constant>(0);
+	const auto fileName = mngr.getString(1);
+	LLU::ThreadPool pool;
+	{
+		LLU::ChunkedFileOptions opts;
+		opts.blockSize = 4096;
+		opts.compression = LLU::Compression::ShuffleLZ;
+		LLU::ChunkedFileWriter writer {fileName, MNumericArray_Type_Real64, t.dimensions(), opts};
+		writer.write(t, pool);
+	}
+	LLU::ChunkedFileReader reader {fileName};
+	mngr.set(reader.readTensor<double>(pool));
+}
+
+/* Measure the time of writing and reading a NumericArray with and without compression, on given number of threads */
+LLU_LIBRARY_FUNCTION(CompressionTiming) {
+	auto na = mngr.getNumericArray<double, LLU::Passing::Constant>(0);
+	const auto fileName = mngr.getString(1);
+	auto threads = static_cast<unsigned>(std::max(mngr.getInteger<mint>(3), mint {1}));
+	LLU::ChunkedFileOptions opts;
+	opts.compression = mngr.getBoolean(2) ? LLU::Compression::ShuffleLZ : LLU::Compression::None;
+	LLU::ThreadPool pool {threads};
+	auto start = std::chrono::steady_clock::now();
+	{
+		LLU::ChunkedFileWriter writer {fileName, MNumericArray_Type_Real64, na.dimensions(), opts};
+		writer.write(na, pool, threads);
+	}
+	auto written = std::chrono::steady_clock::now();
+	LLU::NumericArray<double> dst {0., na.dimensions()};
+	LLU::ChunkedFileReader reader {fileName};
+	reader.readInto(dst, pool, threads);
+	auto read = std::chrono::steady_clock::now();
+	std::chrono::duration<double> writeTime = written - start;
+	std::chrono::duration<double> readTime = read - written;
+	mngr.set(LLU::Tensor<double> {writeTime.count(), readTime.count()});
+}
@@ -0,0 +1,63 @@
+#include <chrono>
+#include <cmath>
+
+#include <LLU/Async/ThreadPool.h>
+#include <LLU/Containers/Expressions.hpp>
+#include <LLU/LLU.h>
+#include <LLU/LibraryLinkFunctionMacro.h>
+
+/* Compute a * x + y for "Real64" NumericArrays x and y in a single pass, the result has dimensions of x */
+LLU_LIBRARY_FUNCTION(LazyAxpy) {
+	auto x = mngr.getNumericArray<double, LLU::Passing::Constant>(0);
+	auto y = mngr.getNumericArray<double, LLU::Passing::Constant>(1);
+	auto a = mngr.getReal(2);
+	mngr.set(LLU::Expr::materialize<LLU::NumericArray<double>>(x * a + y));
+}
+
+/* Evaluate (t^2 - 1) / (t + 2) + Sqrt[Abs[n]] for a real Tensor t and an "Integer32" NumericArray n on a thread pool, in one task per thread */
+LLU_LIBRARY_FUNCTION(LazyMixed) {
+	auto t = mngr.getTensor<double, LLU::Passing::Constant>(0);
+	auto n = mngr.getNumericArray<std::int32_t, LLU::Passing::Constant>(1);
+	auto threads = std::max<mint>(mngr.getInteger<mint>(2), 1);
+	LLU::ThreadPool tp {static_cast<unsigned>(threads)};
+	auto root = LLU::Expr::map([](std::int32_t k) { return std::sqrt(std::abs(static_cast<double>(k))); }, n);
+	mngr.set(LLU::Expr::materialize<LLU::Tensor<double>>(tp, (t * t - 1) / (t + 2) + root, 1, static_cast<unsigned>(threads)));
+}
+
+/* Scale an "Integer64" NumericArray in place by a real factor, rounding towards zero */
+LLU_LIBRARY_FUNCTION(LazyScaleInPlace) {
+	auto na = mngr.getNumericArray<std::int64_t>(0);
+	LLU::Expr::assign(na, na * mngr.getReal(1));
+	mngr.set(na);
+}
+
+/* Measure the average time of evaluating x * a + y * b - x, with lazy expressions (method 0) or with temporary containers (method 1) */
+LLU_LIBRARY_FUNCTION(LazyTiming) {
+	auto x = mngr.getNumericArray<double, LLU::Passing::Constant>(0);
+	auto y = mngr.getNumericArray<double, LLU::Passing::Constant>(1);
+	auto method = mngr.getInteger<mint>(2);
+	auto repetitions = std::max(mngr.getInteger<mint>(3), mint {1});
+	const double a = 1.5;
+	const double b = -0.5;
+	auto start = std::chrono::steady_clock::now();
+	for (mint r = 0; r < repetitions; ++r) {
+		if (method == 0) {
+			auto res = LLU::Expr::materialize<LLU::NumericArray<double>>(x * a + y * b - x);
+		} else {
+			LLU::NumericArray<double> ax {0., x.dimensions()};
+			for (mint i = 0; i < x.size(); ++i) {
+				ax[i] = x[i] * a;
+			}
+			LLU::NumericArray<double> by {0., y.dimensions()};
+			for (mint i = 0; i < y.size(); ++i) {
+				by[i] = y[i] * b;
+			}
+			LLU::NumericArray<double> res {0., x.dimensions()};
+			for (mint i = 0; i < x.size(); ++i) {
+				res[i] = ax[i] + by[i] - x[i];
+			}
+		}
+	}
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	mngr.set(elapsed.count() / static_cast<double>(repetitions));
+}
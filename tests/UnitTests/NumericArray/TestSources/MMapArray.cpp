@@ -0,0 +1,58 @@
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+#include <LLU/Containers/MMapArray.hpp>
+#include <LLU/LLU.h>
+#include <LLU/LibraryLinkFunctionMacro.h>
+
+/* Store a "Real64" NumericArray in a new array file */
+LLU_LIBRARY_FUNCTION(MMapWrite) {
+	auto na = mngr.getNumericArray<double, LLU::Passing::Constant>(0);
+	auto file = LLU::MMapArray<double>::create(mngr.getString(1), na.dimensions());
+	std::copy(na.begin(), na.end(), file.begin());
+	file.flush();
+}
+
+/* Read a whole array file of "Real64" values into a NumericArray */
+LLU_LIBRARY_FUNCTION(MMapRead) {
+	LLU::MMapArray<double> file {mngr.getString(0)};
+	mngr.set(file.toNumericArray());
+}
+
+/* Compute totals of columns of a matrix stored in an array file, reading the file row by row */
+LLU_LIBRARY_FUNCTION(MMapColumnTotals) {
+	LLU::MMapArray<double> file {mngr.getString(0)};
+	file.advise(LLU::AccessHint::Sequential);
+	const mint rows = file.dimension(0);
+	const mint cols = file.dimension(1);
+	LLU::Tensor<double> totals(0., {cols});
+	for (mint r = 0; r < rows; ++r) {
+		auto row = file.chunk(r * cols, cols);
+		std::transform(row.begin(), row.end(), totals.begin(), totals.begin(), std::plus<> {});
+	}
+	mngr.set(totals);
+}
+
+/* Get a column of a matrix stored in an array file */
+LLU_LIBRARY_FUNCTION(MMapColumn) {
+	LLU::MMapArray<double> file {mngr.getString(0)};
+	auto column = file.lane(0, {0, mngr.getInteger<mint>(1) - 1});
+	mngr.set(LLU::Tensor<double>(column.begin(), column.end(), {column.size()}));
+}
+
+/* Multiply all elements of an array file by a factor, in place */
+LLU_LIBRARY_FUNCTION(MMapScaleInPlace) {
+	LLU::MMapArray<double> file {mngr.getString(0), LLU::MMapMode::ReadWrite};
+	auto factor = mngr.getReal(1);
+	for (auto& elem : file) {
+		elem *= factor;
+	}
+	file.flush();
+}
+
+/* Sum a raw file of "Real64" values, skipping a given number of bytes at the beginning */
+LLU_LIBRARY_FUNCTION(MMapRawTotal) {
+	auto file = LLU::MMapArray<double>::raw(mngr.getString(0), LLU::MMapMode::ReadOnly, static_cast<std::size_t>(mngr.getInteger<mint>(1)));
+	mngr.set(std::accumulate(file.cbegin(), file.cend(), 0.0));
+}
@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+
+#include <LLU/Containers/NumericArrayBatch.hpp>
+#include <LLU/LLU.h>
+#include <LLU/LibraryLinkFunctionMacro.h>
+
+namespace {
+	/// Return a batch as {"Offsets" -> offsets, "Values" -> values} or as a list of separate NumericArrays
+	template<typename T>
+	LLU::DataList<LLU::NodeType::NumericArray> batchResult(LLU::NumericArrayBatch<T>&& batch, bool separate) {
+		if (separate) {
+			return batch.toDataList();
+		}
+		LLU::DataList<LLU::NodeType::NumericArray> res;
+		res.push_back("Offsets", batch.offsets());
+		res.push_back("Values", std::move(batch.values()));
+		return res;
+	}
+
+	/// Store cumulative sums of consecutive segments of x of given lengths as items of a batch
+	LLU::NumericArrayBatch<double> segmentAccumulate(const LLU::NumericArray<double>& x, const LLU::Tensor<mint>& lengths) {
+		if (std::accumulate(lengths.begin(), lengths.end(), mint {0}) != x.size()) {
+			LLU::ErrorManager::throwException(LLU::ErrorName::DimensionsError);
+		}
+		LLU::NumericArrayBatch<double> batch {lengths};
+		for (mint i = 0; i < batch.size(); ++i) {
+			auto item = batch[i];
+			const double* segment = x.data() + batch.layout().offset(i);
+			std::partial_sum(segment, segment + item.size(), item.begin());
+		}
+		return batch;
+	}
+}  // namespace
+
+/* Cumulative sums of segments of a "Real64" NumericArray, returned as values and offsets or as a list of NumericArrays */
+LLU_LIBRARY_FUNCTION(SegmentAccumulate) {
+	auto x = mngr.getNumericArray<double, LLU::Passing::Constant>(0);
+	auto lengths = mngr.getTensor<mint, LLU::Passing::Constant>(1);
+	auto separate = mngr.getBoolean(2);
+	mngr.set(batchResult(segmentAccumulate(x, lengths), separate));
+}
+
+/* Batch of n "Integer32" matrices, the i-th one (starting from 1) has dimensions {i, 2} and all elements equal to i */
+LLU_LIBRARY_FUNCTION(BatchOfMatrices) {
+	auto n = mngr.getInteger<mint>(0);
+	LLU::BatchLayout layout;
+	layout.reserve(n, 2 * n);
+	for (mint i = 1; i <= n; ++i) {
+		layout.addItem({i, 2});
+	}
+	LLU::NumericArrayBatch<std::int32_t> batch {std::move(layout)};
+	for (mint i = 0; i < batch.size(); ++i) {
+		auto item = batch[i];
+		std::fill(item.begin(), item.end(), static_cast<std::int32_t>(item.dimension(0)));
+	}
+	mngr.set(batch.toDataList());
+}
+
+/* Average time in seconds of creating n vectors of given length as separate NumericArrays (method 0), as a batch returned as values and offsets (1),
+ * or as a batch copied into separate NumericArrays (2) */
+LLU_LIBRARY_FUNCTION(BatchTiming) {
+	auto n = mngr.getInteger<mint>(0);
+	auto length = mngr.getInteger<mint>(1);
+	auto method = mngr.getInteger<mint>(2);
+	auto repetitions = std::max(mngr.getInteger<mint>(3), mint {1});
+	auto start = std::chrono::steady_clock::now();
+	for (mint r = 0; r < repetitions; ++r) {
+		if (method == 0) {
+			LLU::DataList<LLU::NodeType::NumericArray> res;
+			for (mint i = 0; i < n; ++i) {
+				res.push_back(LLU::NumericArray<double>(static_cast<double>(i), LLU::MArrayDimensions {length}));
+			}
+		} else {
+			LLU::NumericArrayBatch<double> batch {std::vector<mint>(static_cast<std::size_t>(n), length)};
+			for (mint i = 0; i < n; ++i) {
+				auto item = batch[i];
+				std::fill(item.begin(), item.end(), static_cast<double>(i));
+			}
+			auto res = batchResult(std::move(batch), method == 2);
+		}
+	}
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	mngr.set(elapsed.count() / static_cast<double>(repetitions));
+}
@@ -1,5 +1,5 @@
 Needs["CCompilerDriver`"]
-lib = CreateLibrary[{"NumericArrayOperations.cpp"}, "NumericArrayOperations", options, "Defines" -> {"LLU_LOG_DEBUG"}];
+lib = CreateLibrary[{"NumericArrayOperations.cpp", "TypeDispatch.cpp", "ScratchArena.cpp", "AlignedBuffer.cpp", "NumericArrayBatch.cpp", "RaggedArray.cpp", "Expressions.cpp", "MMapArray.cpp", "ChunkedFile.cpp"}, "NumericArrayOperations", options, "Defines" -> {"LLU_LOG_DEBUG"}];
 Get[FileNameJoin[{$LLUSharedDir, "LibraryLinkUtilities.wl"}]];
 `LLU`InitializePacletLibrary[lib];
 
@@ -25,4 +25,42 @@ CopyThroughTensor = `LLU`PacletFunctionLoad["CopyThroughTensor", {NumericArray},
 GetLargest = `LLU`PacletFunctionLoad["GetLargest", {NumericArray, {NumericArray, "Constant"}, {NumericArray, "Manual"}}, Integer];
 EmptyView = `LLU`PacletFunctionLoad["EmptyView", {}, {Integer, 1}];
 SumLargestDimensions = `LLU`PacletFunctionLoad["SumLargestDimensions", {NumericArray, {NumericArray, "Constant"}}, Integer];
-ReverseNA = `LLU`PacletFunctionLoad["Reverse", {{NumericArray, "Constant"}}, NumericArray];
\ No newline at end of file
+ReverseNA = `LLU`PacletFunctionLoad["Reverse", {{NumericArray, "Constant"}}, NumericArray];
+FloatingTotal = `LLU`PacletFunctionLoad["FloatingTotal", {{NumericArray, "Constant"}}, Real];
+IntegerMax = `LLU`PacletFunctionLoad["IntegerMax", {{NumericArray, "Constant"}}, Integer];
+DispatchDot = `LLU`PacletFunctionLoad["DispatchDot", {{NumericArray, "Constant"}, {NumericArray, "Constant"}}, Real];
+DispatchDotTensor = `LLU`PacletFunctionLoad["DispatchDotTensor", {{NumericArray, "Constant"}, {_, _, "Constant"}}, Real];
+ScratchPipeline = `LLU`PacletFunctionLoad["ScratchPipeline", {{NumericArray, "Constant"}, "Boolean"}, NumericArray];
+ScratchPipelineTiming = `LLU`PacletFunctionLoad["ScratchPipelineTiming", {{NumericArray, "Constant"}, "Boolean", Integer}, {Real, 1}];
+ScratchArenaStatistics = `LLU`PacletFunctionLoad["ScratchArenaStatistics", {Integer}, {Integer, 1}];
+PeeledTotal = `LLU`PacletFunctionLoad["PeeledTotal", {{NumericArray, "Constant"}, Integer}, Real];
+AlignedScale = `LLU`PacletFunctionLoad["AlignedScale", {{NumericArray, "Constant"}, Real}, NumericArray];
+AlignedBufferProperties = `LLU`PacletFunctionLoad["AlignedBufferProperties", {Integer, "Boolean"}, {Integer, 1}];
+AlignedBufferMove = `LLU`PacletFunctionLoad["AlignedBufferMove", {Integer}, {Integer, 1}];
+PeeledTotalTiming = `LLU`PacletFunctionLoad["PeeledTotalTiming", {{NumericArray, "Constant"}, Integer, Integer}, Real];
+SegmentAccumulate = `LLU`PacletFunctionLoad["SegmentAccumulate", {{NumericArray, "Constant"}, {Integer, 1, "Constant"}, "Boolean"}, "DataStore"];
+BatchOfMatrices = `LLU`PacletFunctionLoad["BatchOfMatrices", {Integer}, "DataStore"];
+BatchTiming = `LLU`PacletFunctionLoad["BatchTiming", {Integer, Integer, Integer, Integer}, Real];
+RaggedRowTotals = `LLU`PacletFunctionLoad["RaggedRowTotals", {NumericArray, NumericArray}, {Real, 1}];
+RaggedSortRows = `LLU`PacletFunctionLoad["RaggedSortRows", {NumericArray, NumericArray, Integer}, "DataStore"];
+RaggedFromDataList = `LLU`PacletFunctionLoad["RaggedFromDataList", {"DataStore"}, "DataStore"];
+RaggedSortTiming = `LLU`PacletFunctionLoad["RaggedSortTiming", {NumericArray, NumericArray, Integer, Integer}, Real];
+LazyAxpy = `LLU`PacletFunctionLoad["LazyAxpy", {{NumericArray, "Constant"}, {NumericArray, "Constant"}, Real}, NumericArray];
+LazyMixed = `LLU`PacletFunctionLoad["LazyMixed", {{Real, _, "Constant"}, {NumericArray, "Constant"}, Integer}, {Real, _}];
+LazyScaleInPlace = `LLU`PacletFunctionLoad["LazyScaleInPlace", {NumericArray, Real}, NumericArray];
+LazyTiming = `LLU`PacletFunctionLoad["LazyTiming", {{NumericArray, "Constant"}, {NumericArray, "Constant"}, Integer, Integer}, Real];
+MMapWrite = `LLU`PacletFunctionLoad["MMapWrite", {{NumericArray, "Constant"}, String}, "Void"];
+MMapRead = `LLU`PacletFunctionLoad["MMapRead", {String}, NumericArray];
+MMapColumnTotals = `LLU`PacletFunctionLoad["MMapColumnTotals", {String}, {Real, 1}];
+MMapColumn = `LLU`PacletFunctionLoad["MMapColumn", {String, Integer}, {Real, 1}];
+MMapScaleInPlace = `LLU`PacletFunctionLoad["MMapScaleInPlace", {String, Real}, "Void"];
+MMapRawTotal = `LLU`PacletFunctionLoad["MMapRawTotal", {String, Integer}, Real];
+ChunkedWrite = `LLU`PacletFunctionLoad["ChunkedWrite", {{NumericArray, "Constant"}, String, Integer, "Boolean", Integer}, "Void"];
+ChunkedRead = `LLU`PacletFunctionLoad["ChunkedRead", {String, Integer}, NumericArray];
+ChunkedStreamTotal = `LLU`PacletFunctionLoad["ChunkedStreamTotal", {String}, Real];
+ChunkedReadTiming = `LLU`PacletFunctionLoad["ChunkedReadTiming", {String, Integer, Integer}, Real];
+CompressedWrite = `LLU`PacletFunctionLoad["CompressedWrite", {{NumericArray, "Constant"}, String, Integer}, "Void"];
+ChunkedStoredSize = `LLU`PacletFunctionLoad["ChunkedStoredSize", {String}, Integer];
+ChunkedBlockTotal = `LLU`PacletFunctionLoad["ChunkedBlockTotal", {String, Integer}, Real];
+CompressedTensorRoundTrip = `LLU`PacletFunctionLoad["CompressedTensorRoundTrip", {{Real, _, "Constant"}, String}, {Real, _}];
+CompressionTiming = `LLU`PacletFunctionLoad["CompressionTiming", {{NumericArray, "Constant"}, String, "Boolean", Integer}, {Real, 1}];
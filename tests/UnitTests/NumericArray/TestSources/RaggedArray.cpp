@@ -0,0 +1,57 @@
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+
+#include <LLU/Async/ThreadPool.h>
+#include <LLU/Containers/RaggedArray.hpp>
+#include <LLU/LLU.h>
+#include <LLU/LibraryLinkFunctionMacro.h>
+
+/* Sums of rows of a ragged array passed as two arguments: "Real64" values and offsets */
+LLU_LIBRARY_FUNCTION(RaggedRowTotals) {
+	auto ragged = mngr.get<LLU::RaggedArray<double>>(0);
+	LLU::Tensor<double> totals(0., {ragged.rowCount()});
+	mint i = 0;
+	for (auto row : ragged) {
+		totals[i++] = std::accumulate(row.begin(), row.end(), 0.0);
+	}
+	mngr.set(totals);
+}
+
+/* Sort every row of a ragged array of "Integer32" values on a thread pool with given number of threads and return it as a DataList */
+LLU_LIBRARY_FUNCTION(RaggedSortRows) {
+	auto ragged = mngr.get<LLU::RaggedArray<std::int32_t>>(0);
+	auto threads = std::max<mint>(mngr.getInteger<mint>(2), 1);
+	LLU::ThreadPool tp {static_cast<unsigned>(threads)};
+	ragged.transformRows(tp, [](auto row) { std::sort(row.begin(), row.end()); }, static_cast<unsigned>(threads));
+	mngr.set(std::move(ragged).toDataList());
+}
+
+/* Reverse rows of a ragged array passed as a DataList {values, offsets}, prepend the row index to every row and return the result as a DataList */
+LLU_LIBRARY_FUNCTION(RaggedFromDataList) {
+	LLU::RaggedArray<mint> ragged {mngr.getDataList<LLU::NodeType::NumericArray>(0)};
+	std::vector<std::vector<mint>> rows;
+	for (mint i = 0; i < ragged.rowCount(); ++i) {
+		auto row = ragged[i];
+		std::vector<mint> newRow {i};
+		newRow.insert(newRow.end(), row.rbegin(), row.rend());
+		rows.push_back(std::move(newRow));
+	}
+	mngr.set(LLU::RaggedArray<mint>::fromRows(rows).toDataList());
+}
+
+/* Average time in seconds of sorting rows of a ragged array with the given number of threads */
+LLU_LIBRARY_FUNCTION(RaggedSortTiming) {
+	auto ragged = mngr.get<LLU::RaggedArray<double>>(0);
+	auto threads = std::max<mint>(mngr.getInteger<mint>(2), 1);
+	auto repetitions = std::max(mngr.getInteger<mint>(3), mint {1});
+	LLU::ThreadPool tp {static_cast<unsigned>(threads)};
+	std::chrono::duration<double> elapsed {0};
+	for (mint r = 0; r < repetitions; ++r) {
+		LLU::RaggedArray<double> copy {ragged.values().clone(), ragged.offsets().clone()};
+		auto start = std::chrono::steady_clock::now();
+		copy.transformRows(tp, [](auto row) { std::sort(row.begin(), row.end()); }, static_cast<unsigned>(threads));
+		elapsed += std::chrono::steady_clock::now() - start;
+	}
+	mngr.set(elapsed.count() / static_cast<double>(repetitions));
+}
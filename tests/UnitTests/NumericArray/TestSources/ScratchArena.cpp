@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <functional>
+
+#include <LLU/Containers/ScratchArena.hpp>
+#include <LLU/LLU.h>
+#include <LLU/LibraryLinkFunctionMacro.h>
+
+namespace {
+	/// Evaluate sqrt(|x^2 + x|)/2 + x in stages, with intermediate arrays created by makeTemporary, \p created counts new NumericArrays
+	template<typename Container, typename Alloc>
+	auto pipeline(const Container& x, Alloc&& makeTemporary, mint& created) {
+		auto squares = makeTemporary();
+		std::transform(x.begin(), x.end(), squares.begin(), [](double v) { return v * v; });
+		auto sums = makeTemporary();
+		std::transform(squares.begin(), squares.end(), x.begin(), sums.begin(), std::plus<> {});
+		auto roots = makeTemporary();
+		std::transform(sums.begin(), sums.end(), roots.begin(), [](double v) { return std::sqrt(std::abs(v)); });
+		LLU::NumericArray<double> result {0., x.dimensions()};
+		++created;
+		std::transform(roots.begin(), roots.end(), x.begin(), result.begin(), [](double r, double v) { return 0.5 * r + v; });
+		return result;
+	}
+
+	LLU::NumericArray<double> kernelPipeline(const LLU::NumericArray<double>& x, mint& created) {
+		return pipeline(
+			x,
+			[&x, &created] {
+				++created;
+				return LLU::NumericArray<double> {0., x.dimensions()};
+			},
+			created);
+	}
+
+	LLU::NumericArray<double> arenaPipeline(const LLU::NumericArray<double>& x, LLU::ScratchArena& arena, mint& created) {
+		return pipeline(x, [&x, &arena] { return arena.allocate<double>(x.dimensions()); }, created);
+	}
+}  // namespace
+
+/* Evaluate a multistage computation with temporaries allocated as NumericArrays or in a ScratchArena */
+LLU_LIBRARY_FUNCTION(ScratchPipeline) {
+	auto x = mngr.getNumericArray<double, LLU::Passing::Constant>(0);
+	auto useArena = mngr.getBoolean(1);
+	mint created = 0;
+	if (useArena) {
+		LLU::ScratchArena arena;
+		mngr.set(arenaPipeline(x, arena, created));
+	} else {
+		mngr.set(kernelPipeline(x, created));
+	}
+}
+
+/* Repeat the computation from ScratchPipeline and return {average time in seconds, NumericArrays created per call, system allocations made by the arena} */
+LLU_LIBRARY_FUNCTION(ScratchPipelineTiming) {
+	auto x = mngr.getNumericArray<double, LLU::Passing::Constant>(0);
+	auto useArena = mngr.getBoolean(1);
+	auto repetitions = std::max(mngr.getInteger<mint>(2), mint {1});
+	LLU::ScratchArena arena;
+	mint created = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (mint i = 0; i < repetitions; ++i) {
+		if (useArena) {
+			arena.reset();
+			arenaPipeline(x, arena, created);
+		} else {
+			kernelPipeline(x, created);
+		}
+	}
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	LLU::Tensor<double> res {elapsed.count() / static_cast<double>(repetitions), static_cast<double>(created) / static_cast<double>(repetitions),
+							 static_cast<double>(arena.systemAllocationCount())};
+	mngr.set(res);
+}
+
+/* Check alignment and dimensions of arrays allocated in a ScratchArena with given block size, return {allocations, system allocations, bytes in use} */
+LLU_LIBRARY_FUNCTION(ScratchArenaStatistics) {
+	auto blockSize = mngr.getInteger<mint>(0);
+	LLU::ScratchArena arena {static_cast<std::size_t>(blockSize)};
+	auto a = arena.allocate<std::uint8_t>({3});
+	auto b = arena.allocate<double>({4, 5}, 2.5);
+	auto c = arena.allocate<std::complex<float>>({7, 1, 2});
+	for (const void* p : {static_cast<const void*>(a.data()), static_cast<const void*>(b.data()), static_cast<const void*>(c.data())}) {
+		if (reinterpret_cast<std::uintptr_t>(p) % LLU::ScratchArena::Alignment != 0) {
+			LLU::ErrorManager::throwException(LLU::ErrorName::MemoryError);
+		}
+	}
+	if (b.rank() != 2 || b.dimension(1) != 5 || b[{3, 4}] != 2.5 || c.size() != 14) {
+		LLU::ErrorManager::throwException(LLU::ErrorName::DimensionsError);
+	}
+	mngr.set(LLU::Tensor<mint> {static_cast<mint>(arena.allocationCount()), static_cast<mint>(arena.systemAllocationCount()),
+								static_cast<mint>(arena.bytesInUse())});
+}
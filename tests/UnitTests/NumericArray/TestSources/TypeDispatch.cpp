@@ -0,0 +1,42 @@
+#include <algorithm>
+#include <numeric>
+
+#include <LLU/LLU.h>
+#include <LLU/LibraryLinkFunctionMacro.h>
+
+namespace {
+	template<typename ViewA, typename ViewB>
+	double dot(const ViewA& a, const ViewB& b) {
+		if (a.size() != b.size()) {
+			LLU::ErrorManager::throwException(LLU::ErrorName::DimensionsError);
+		}
+		return std::inner_product(a.begin(), a.end(), b.begin(), 0.0);
+	}
+}  // namespace
+
+/* Sum of elements of a "Real32" or "Real64" NumericArray, other types are rejected */
+LLU_LIBRARY_FUNCTION(FloatingTotal) {
+	auto na = mngr.getGenericNumericArray<LLU::Passing::Constant>(0);
+	mngr.set(LLU::dispatch<LLU::FloatingTypes>(na, [](auto&& typedNA) { return std::accumulate(typedNA.begin(), typedNA.end(), 0.0); }));
+}
+
+/* Largest element of an integer NumericArray, the callback is instantiated only for integer types */
+LLU_LIBRARY_FUNCTION(IntegerMax) {
+	mngr.operateOnNumericArray<LLU::IntegerTypes, LLU::Passing::Constant>(0, [&mngr](auto&& na) {
+		mngr.set(na.size() == 0 ? mint {0} : static_cast<mint>(*std::max_element(na.begin(), na.end())));
+	});
+}
+
+/* Dot product of two real NumericArrays of any (possibly different) types */
+LLU_LIBRARY_FUNCTION(DispatchDot) {
+	auto a = mngr.getGenericNumericArray<LLU::Passing::Constant>(0);
+	auto b = mngr.getGenericNumericArray<LLU::Passing::Constant>(1);
+	mngr.set(LLU::dispatch<LLU::RealTypes>(a, b, [](auto&& viewA, auto&& viewB) { return dot(viewA, viewB); }));
+}
+
+/* Dot product of a real NumericArray and a real Tensor */
+LLU_LIBRARY_FUNCTION(DispatchDotTensor) {
+	auto a = mngr.getGenericNumericArray<LLU::Passing::Constant>(0);
+	auto b = mngr.getGenericTensor<LLU::Passing::Constant>(1);
+	mngr.set(LLU::dispatch<LLU::RealTypes>(a, b, [](auto&& viewA, auto&& viewB) { return dot(viewA, viewB); }));
+}
@@ -0,0 +1,100 @@
+/**
+ * @file	SparseArrayTest.cpp
+ * @brief	Unit tests for GenericSparseArray and SparseArray<T>
+ */
+#include <numeric>
+
+#include <LLU/Containers/SparseArray.h>
+#include <LLU/LibraryLinkFunctionMacro.h>
+#include <LLU/MArgumentManager.h>
+
+using LLU::SparseArray;
+using LLU::Tensor;
+
+EXTERN_C DLLEXPORT int WolframLibrary_initialize(WolframLibraryData libData) {
+	LLU::LibraryData::setLibraryData(libData);
+	return 0;
+}
+
+LLU_LIBRARY_FUNCTION(EchoSparseArray) {
+	auto sa = mngr.getGenericSparseArray(0);
+	mngr.set(sa);
+}
+
+LLU_LIBRARY_FUNCTION(CloneSparseArray) {
+	auto sa = mngr.getSparseArray<double, LLU::Passing::Constant>(0);
+	mngr.set(sa.clone());
+}
+
+LLU_LIBRARY_FUNCTION(GetImplicitValue) {
+	auto sa = mngr.getSparseArray<double>(0);
+	mngr.set(sa.implicitValue());
+}
+
+LLU_LIBRARY_FUNCTION(SetImplicitValue) {
+	auto sa = mngr.getSparseArray<mint, LLU::Passing::Manual>(0);
+	sa.setImplicitValue(mngr.getInteger<mint>(1));
+	mngr.set(sa);
+}
+
+LLU_LIBRARY_FUNCTION(GetExplicitValues) {
+	auto sa = mngr.getSparseArray<double>(0);
+	auto values = sa.explicitValues();
+	mngr.set(Tensor<double> {values.begin(), values.end()});
+}
+
+LLU_LIBRARY_FUNCTION(GetRowPointers) {
+	auto sa = mngr.getGenericSparseArray(0);
+	mngr.set(Tensor<mint> {LLU::TensorTypedView<mint> {sa.rowPointersTensor()}});
+}
+
+LLU_LIBRARY_FUNCTION(GetColumnIndices) {
+	auto sa = mngr.getSparseArray<double>(0);
+	auto columns = sa.columnIndices();
+	mngr.set(Tensor<mint> {columns.begin(), columns.end(), {columns.getDimensions(), columns.getRank()}});
+}
+
+LLU_LIBRARY_FUNCTION(GetExplicitPositions) {
+	auto sa = mngr.getSparseArray<double>(0);
+	mngr.set(sa.explicitPositions());
+}
+
+LLU_LIBRARY_FUNCTION(SparseToDense) {
+	auto sa = mngr.getSparseArray<double>(0);
+	mngr.set(sa.toTensor());
+}
+
+LLU_LIBRARY_FUNCTION(DenseToSparse) {
+	auto t = mngr.getTensor<double>(0);
+	SparseArray<double> sa {t, mngr.getReal(1)};
+	mngr.set(sa);
+}
+
+LLU_LIBRARY_FUNCTION(FromCOO) {
+	auto positions = mngr.getTensor<mint>(0);
+	auto values = mngr.getTensor<double>(1);
+	auto dims = mngr.getTensor<mint>(2);
+	SparseArray<double> sa {positions, values, LLU::MArrayDimensions {dims.begin(), dims.end()}};
+	mngr.set(sa);
+}
+
+/// Sum of each row computed directly on the CSR representation
+LLU_LIBRARY_FUNCTION(RowSums) {
+	auto sa = mngr.getSparseArray<double>(0);
+	auto rowPtr = sa.rowPointers();
+	auto values = sa.explicitValues();
+	auto dims = sa.dimensions();
+	Tensor<double> res(0.0, {dims.get(0)});
+	auto implicitPerRow = dims.flatCount() / dims.get(0);
+	for (mint row = 0; row < dims.get(0); ++row) {
+		auto nnz = rowPtr[row + 1] - rowPtr[row];
+		res[row] = std::accumulate(values.begin() + rowPtr[row], values.begin() + rowPtr[row + 1], 0.0) +
+				   static_cast<double>(implicitPerRow - nnz) * sa.implicitValue();
+	}
+	mngr.set(res);
+}
+
+LLU_LIBRARY_FUNCTION(SparseArrayTypeMismatch) {
+	auto sa = mngr.getSparseArray<mint>(0);
+	mngr.set(sa.getRank());
+}
@@ -0,0 +1,78 @@
+/**
+ * @file	SparseKernels.cpp
+ * @brief	Unit tests and benchmarks for parallel sparse kernels
+ */
+#include <chrono>
+#include <limits>
+
+#include <LLU/Async/ThreadPool.h>
+#include <LLU/Containers/SparseKernels.hpp>
+#include <LLU/LibraryLinkFunctionMacro.h>
+#include <LLU/MArgumentManager.h>
+
+using LLU::SparseArray;
+using LLU::Tensor;
+
+namespace {
+	unsigned threadCount(mint requested) {
+		return requested > 0 ? static_cast<unsigned>(requested) : std::max(std::thread::hardware_concurrency(), 1U);
+	}
+}
+
+LLU_LIBRARY_FUNCTION(SparseDot) {
+	auto a = mngr.getSparseArray<double, LLU::Passing::Constant>(0);
+	auto b = mngr.getTensor<double, LLU::Passing::Constant>(1);
+	LLU::ThreadPool tp {threadCount(mngr.getInteger<mint>(2))};
+	mngr.set(LLU::Sparse::dot(tp, a, b));
+}
+
+LLU_LIBRARY_FUNCTION(SparseDotInteger) {
+	auto a = mngr.getSparseArray<mint, LLU::Passing::Constant>(0);
+	auto b = mngr.getTensor<mint, LLU::Passing::Constant>(1);
+	LLU::BasicPool tp {threadCount(mngr.getInteger<mint>(2))};
+	mngr.set(LLU::Sparse::dot(tp, a, b));
+}
+
+LLU_LIBRARY_FUNCTION(SparseTranspose) {
+	auto a = mngr.getSparseArray<double, LLU::Passing::Constant>(0);
+	LLU::ThreadPool tp {threadCount(mngr.getInteger<mint>(1))};
+	mngr.set(LLU::Sparse::transpose(tp, a));
+}
+
+LLU_LIBRARY_FUNCTION(SparseRowSums) {
+	auto a = mngr.getSparseArray<double, LLU::Passing::Constant>(0);
+	LLU::ThreadPool tp {threadCount(mngr.getInteger<mint>(1))};
+	mngr.set(LLU::Sparse::rowSums(tp, a));
+}
+
+LLU_LIBRARY_FUNCTION(SparseColumnSums) {
+	auto a = mngr.getSparseArray<double, LLU::Passing::Constant>(0);
+	LLU::ThreadPool tp {threadCount(mngr.getInteger<mint>(1))};
+	mngr.set(LLU::Sparse::columnSums(tp, a));
+}
+
+LLU_LIBRARY_FUNCTION(SparseRowMax) {
+	auto a = mngr.getSparseArray<double, LLU::Passing::Constant>(0);
+	LLU::ThreadPool tp {threadCount(mngr.getInteger<mint>(1))};
+	mngr.set(LLU::Sparse::reduceRows(tp, a, -std::numeric_limits<double>::infinity(), [](double x, double y) { return std::max(x, y); }));
+}
+
+LLU_LIBRARY_FUNCTION(RowPartition) {
+	auto a = mngr.getGenericSparseArray<LLU::Passing::Constant>(0);
+	auto bounds = LLU::Sparse::balancedRowPartition(a.rowPointersTensor(), static_cast<unsigned>(mngr.getInteger<mint>(1)));
+	mngr.set(Tensor<mint> {bounds});
+}
+
+/// Run Dot[a, b] given number of times on a fresh pool and return the average time in seconds
+LLU_LIBRARY_FUNCTION(SparseDotTiming) {
+	auto a = mngr.getSparseArray<double, LLU::Passing::Constant>(0);
+	auto b = mngr.getTensor<double, LLU::Passing::Constant>(1);
+	LLU::ThreadPool tp {threadCount(mngr.getInteger<mint>(2))};
+	const auto repetitions = std::max(mngr.getInteger<mint>(3), mint {1});
+	auto start = std::chrono::steady_clock::now();
+	for (mint i = 0; i < repetitions; ++i) {
+		auto res = LLU::Sparse::dot(tp, a, b);
+	}
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	mngr.set(elapsed.count() / static_cast<double>(repetitions));
+}
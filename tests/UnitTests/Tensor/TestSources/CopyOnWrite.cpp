@@ -0,0 +1,43 @@
+#include <LLU/Containers/CopyOnWrite.hpp>
+#include <LLU/Containers/Tensor.h>
+#include <LLU/LibraryLinkFunctionMacro.h>
+#include <LLU/MArgumentManager.h>
+
+namespace {
+	/// Replace negative elements with 0, only the first write clones the container
+	template<class Container>
+	void clampNegative(LLU::CopyOnWrite<Container>& cow) {
+		for (mint i = 0; i < cow.size(); ++i) {
+			if (cow.read()[i] < 0) {
+				cow[i] = 0;
+			}
+		}
+	}
+}
+
+LLU_LIBRARY_FUNCTION(ClampNegative) {
+	LLU::CopyOnWrite<LLU::Tensor<double>> cow {mngr.getTensor<double, LLU::Passing::Shared>(0)};
+	clampNegative(cow);
+	mngr.set(cow.read());
+}
+
+LLU_LIBRARY_FUNCTION(ClampNegativeCopiedQ) {
+	LLU::CopyOnWrite<LLU::Tensor<double>> cow {mngr.getTensor<double, LLU::Passing::Shared>(0)};
+	clampNegative(cow);
+	mngr.setBoolean(cow.copiedQ());
+}
+
+LLU_LIBRARY_FUNCTION(SharedTotal) {
+	const LLU::CopyOnWrite<LLU::Tensor<double>> cow {mngr.getTensor<double, LLU::Passing::Shared>(0)};
+	double total = 0.0;
+	for (auto elem : cow) {
+		total += elem;
+	}
+	mngr.setReal(total);
+}
+
+LLU_LIBRARY_FUNCTION(OwnedWriteCopiedQ) {
+	LLU::CopyOnWrite<LLU::Tensor<double>> cow {LLU::Tensor<double> {-1.0, {3}}};
+	clampNegative(cow);
+	mngr.setBoolean(cow.copiedQ());
+}